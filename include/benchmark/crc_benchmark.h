@@ -0,0 +1,50 @@
+#ifndef CRC_BENCHMARK_H
+#define CRC_BENCHMARK_H
+/**
+ * @copyright
+ * @file crc_benchmark.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief CRC benchmark function signatures
+ *        The checksum of the whole flash bank 1 is computed by the flash CRC unit and by a table driven software CRC32
+ *        It is only built when the makefile is run with BENCHMARK=1
+ */
+
+#include <stdint.h>
+
+/**
+ *  @defgroup CrcBenchmarkGroup CRC benchmark macros, structure and functions
+ *  @brief CRC benchmark macros, structure and functions
+ *  @{
+ */
+
+/*!< Number of entries of the software CRC32 lookup table */
+#define CRC_BENCHMARK_TABLE_SIZE 256U
+
+/**
+ * @brief CRC benchmark results
+ *        Number of core clock cycles taken by each test and computed checksums. They are meant to be read with the debugger
+ */
+typedef struct {
+	uint32_t hardware_cycles;  /*!< Flash CRC unit over flash bank 1 */
+	uint32_t software_cycles;  /*!< Software CRC32 over flash bank 1 */
+	uint32_t hardware_crc;     /*!< Checksum computed by the flash CRC unit */
+	uint32_t software_crc;     /*!< Checksum computed by the software CRC32 */
+} crc_benchmark_result;
+
+/**
+ * @brief Results of the last run
+ */
+extern crc_benchmark_result crc_benchmark;
+
+/**
+ * @brief Function: crc_benchmark_run
+ *
+ * Compute the checksum of flash bank 1 with the flash CRC unit and in software and store the number of cycles taken in crc_benchmark
+ * It must be called after image_crc_check as the flash CRC unit is used by the image verification at boot
+ */
+void crc_benchmark_run(void);
+
+/** @} */ // End of CrcBenchmarkGroup group
+
+#endif // CRC_BENCHMARK_H
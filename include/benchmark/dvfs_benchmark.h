@@ -0,0 +1,47 @@
+#ifndef DVFS_BENCHMARK_H
+#define DVFS_BENCHMARK_H
+/**
+ * @copyright
+ * @file dvfs_benchmark.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief DVFS benchmark function signatures
+ *        The system switches between every pair of clock profiles and the duration of each transition is recorded
+ *        It is only built when the makefile is run with BENCHMARK=1
+ */
+
+#include <stdint.h>
+
+#include "clock/dvfs.h"
+
+/**
+ *  @defgroup DvfsBenchmarkGroup DVFS benchmark macros, structure and functions
+ *  @brief DVFS benchmark macros, structure and functions
+ *  @{
+ */
+
+/**
+ * @brief DVFS benchmark results
+ *        Duration in nanoseconds of the transition from the profile of the row to the profile of the column. They are meant to be read with the debugger
+ */
+typedef struct {
+	uint32_t transition_ns[DVFS_PROFILE_NUMBER][DVFS_PROFILE_NUMBER];   /*!< Transition durations */
+	uint32_t notifications;                                           /*!< Number of notifications received */
+} dvfs_benchmark_result;
+
+/**
+ * @brief Results of the last run
+ */
+extern dvfs_benchmark_result dvfs_benchmark;
+
+/**
+ * @brief Function: dvfs_benchmark_run
+ *
+ * Switch between every pair of profiles and store the duration of the transitions in dvfs_benchmark
+ * The system is back in profile DVFS_PROFILE_BURST when the function returns
+ */
+void dvfs_benchmark_run(void);
+
+/** @} */ // End of DvfsBenchmarkGroup group
+
+#endif // DVFS_BENCHMARK_H
@@ -0,0 +1,56 @@
+#ifndef ITCM_BENCHMARK_H
+#define ITCM_BENCHMARK_H
+/**
+ * @copyright
+ * @file itcm_benchmark.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief ITCM benchmark function signatures
+ *        The same interrupt handler body and digital signal processing loop are executed from the flash and from the instruction tightly coupled memory (ITCM)
+ *        It is only built when the makefile is run with BENCHMARK=1
+ */
+
+#include <stdint.h>
+
+/**
+ *  @defgroup ItcmBenchmarkGroup ITCM benchmark macros, structure and functions
+ *  @brief ITCM benchmark macros, structure and functions
+ *  @{
+ */
+
+/*!< Number of taps of the finite impulse response (FIR) filter */
+#define ITCM_BENCHMARK_FIR_TAPS 32U
+
+/*!< Number of samples filtered by the FIR filter */
+#define ITCM_BENCHMARK_FIR_SAMPLES 256U
+
+/*!< Number of times the interrupt handler body is executed */
+#define ITCM_BENCHMARK_ISR_CALLS 1000U
+
+/**
+ * @brief ITCM benchmark results
+ *        Number of core clock cycles taken by each test. They are meant to be read with the debugger
+ */
+typedef struct {
+	uint32_t isr_flash;  /*!< Interrupt handler body executed from the flash */
+	uint32_t isr_itcm;   /*!< Interrupt handler body executed from the ITCM */
+	uint32_t fir_flash;  /*!< FIR filter executed from the flash */
+	uint32_t fir_itcm;   /*!< FIR filter executed from the ITCM */
+} itcm_benchmark_result;
+
+/**
+ * @brief Results of the last run
+ */
+extern itcm_benchmark_result itcm_benchmark;
+
+/**
+ * @brief Function: itcm_benchmark_run
+ *
+ * Run every test from the flash and from the ITCM and store the number of cycles taken in itcm_benchmark
+ * Data is placed in the data tightly coupled memory (DTCM) so that only the instruction fetch differs
+ */
+void itcm_benchmark_run(void);
+
+/** @} */ // End of ItcmBenchmarkGroup group
+
+#endif // ITCM_BENCHMARK_H
@@ -0,0 +1,60 @@
+#ifndef LOW_POWER_BENCHMARK_H
+#define LOW_POWER_BENCHMARK_H
+/**
+ * @copyright
+ * @file low_power_benchmark.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Low power benchmark function signatures
+ *        The core goes to Stop mode a number of times and the wakeup latencies are recorded
+ *        It is only built when the makefile is run with BENCHMARK=1
+ */
+
+#include <stdint.h>
+
+/**
+ *  @defgroup LowPowerBenchmarkGroup Low power benchmark macros, structure and functions
+ *  @brief Low power benchmark macros, structure and functions
+ *  @{
+ */
+
+/*!< Number of times the core goes to Stop mode */
+#define LOW_POWER_BENCHMARK_ITERATIONS 16U
+
+/*!< Time spent in Stop mode by each iteration in milliseconds */
+#define LOW_POWER_BENCHMARK_STOP_MS 10U
+
+/**
+ * @brief Latency statistics in nanoseconds
+ */
+typedef struct {
+	uint32_t min_ns;       /*!< Shortest latency */
+	uint32_t max_ns;       /*!< Longest latency */
+	uint32_t average_ns;   /*!< Average latency */
+} low_power_benchmark_latency;
+
+/**
+ * @brief Low power benchmark results
+ *        They are meant to be read with the debugger
+ */
+typedef struct {
+	low_power_benchmark_latency wake_to_instruction;   /*!< Wakeup timer expiry to first instruction after WFI */
+	low_power_benchmark_latency wake_to_full_speed;    /*!< First instruction after WFI to burst profile restored */
+	uint32_t stop_entered;                             /*!< Number of iterations the whole system entered Stop mode */
+} low_power_benchmark_result;
+
+/**
+ * @brief Results of the last run
+ */
+extern low_power_benchmark_result low_power_benchmark;
+
+/**
+ * @brief Function: low_power_benchmark_run
+ *
+ * Go to Stop mode LOW_POWER_BENCHMARK_ITERATIONS times from profile DVFS_PROFILE_BURST and store the wakeup latencies in low_power_benchmark
+ */
+void low_power_benchmark_run(void);
+
+/** @} */ // End of LowPowerBenchmarkGroup group
+
+#endif // LOW_POWER_BENCHMARK_H
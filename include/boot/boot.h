@@ -0,0 +1,88 @@
+#ifndef BOOT_H
+#define BOOT_H
+/**
+ * @copyright
+ * @file boot.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Boot function signatures and variables
+ */
+
+#include <stdint.h>
+
+#include "boot/pll.h"
+
+/**
+ *  @defgroup BootGroup Boot macros, structure and functions
+ *  @brief Boot macros, structure and functions
+ *  @{
+ */
+
+/*!< System clock frequency in Hz. It is the P output of PLL1 whose profile depends on the core supply as VOS0 is only available when the core is supplied by the LDO regulator */
+#define BOOT_SYSCLK_FREQ ((uint32_t)PLL_P_FREQ(PLL1))
+
+/*!< AXI and AHB clock frequency in Hz. It is the clock of the flash memory */
+#define BOOT_AXI_FREQ (BOOT_SYSCLK_FREQ / 2UL)
+
+/**
+ * @brief Boot phase timestamps
+ *        Each field is the value of the cycle counter at the end of the phase. The cycle counter is reset at the beginning of the reset handler
+ */
+typedef struct {
+	uint32_t pll_start;         /*!< PLLs turned on by systemInit */
+	uint32_t memory_init_end;   /*!< Copy and zero tables walked while PLLs lock */
+	uint32_t pll_locked;        /*!< All PLLs reported locked. It is sampled after memory_init_end hence it is the end of the wait for the PLLs, not their lock time */
+	uint32_t voltage_ready;     /*!< Core voltage reached the scale required by the system clock */
+	uint32_t sysclk_switched;   /*!< System clock switched to PLL1 and flash latency updated */
+} boot_phase_times;
+
+/**
+ * @brief Timestamps of the boot phases of the last boot
+ *        It is stored in section .noinit as it is written before the uninitialized data sections are cleared
+ */
+extern boot_phase_times boot_phase;
+
+/**
+ * @brief Number of core clock cycles elapsed from the first instruction of the reset handler to the call of main
+ *        It is stored in section .noinit hence the startup code never clears it
+ */
+extern uint32_t boot_cycles;
+
+/**
+ * @brief Function: systemInit
+ *
+ * Set the reset and clock control to the desired reset state as well as a few other registers
+ * It is called by the reset handler before the data and uninitialized data sections are initialized hence it must not rely on global variables
+ */
+void systemInit(void);
+
+/**
+ * @brief Function: systemClockSwitch
+ *
+ * Wait for the PLLs and the voltage scaling started by systemInit, switch the system clock to PLL1 and set the flash latency accordingly
+ * It is called by the reset handler after the data and uninitialized data sections are initialized
+ */
+void systemClockSwitch(void);
+
+/**
+ * @brief Function: boot_memory_init_cycles
+ *
+ * \return number of cycles spent initializing memory while the PLLs turned on by systemInit were locking
+ *
+ * This is the time saved compared to polling PLL ready flags in systemInit before initializing memory, unless PLLs locked earlier
+ */
+uint32_t boot_memory_init_cycles(void);
+
+/**
+ * @brief Function: boot_pll_wait_cycles
+ *
+ * \return number of cycles systemClockSwitch waited for the PLLs to lock once memory had been initialized
+ *
+ * A non-zero value means that PLLs lock slower than memory is initialized and their lock time is the sum of both durations
+ * Otherwise PLLs locked during memory initialization and boot_memory_init_cycles is an upper bound of their lock time
+ */
+uint32_t boot_pll_wait_cycles(void);
+
+/** @} */ // End of BootGroup group
+
+#endif // BOOT_H
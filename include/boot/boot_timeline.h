@@ -0,0 +1,86 @@
+#ifndef BOOT_TIMELINE_H
+#define BOOT_TIMELINE_H
+/**
+ * @copyright
+ * @file boot_timeline.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Boot timeline function signatures
+ *        The duration of the boot phases of the last boots is kept in a ring in the backup SRAM in order to track boot time across reboots
+ */
+
+#include <stdint.h>
+
+/**
+ *  @defgroup BootTimelineGroup Boot timeline macros, structure and functions
+ *  @brief Boot timeline macros, structure and functions
+ *  @{
+ */
+
+/*!< Value of the ring magic word once it has been initialized ("BOOT" in ASCII) */
+#define BOOT_TIMELINE_MAGIC 0x424F4F54UL
+
+/*!< Number of boots kept in the ring */
+#define BOOT_TIMELINE_DEPTH 8U
+
+/**
+ * @brief Boot phases
+ *        Phase values are hardcoded in the reset handler (boot.s) hence they must not be reordered
+ */
+typedef enum {
+	BOOT_TIMELINE_RESET            = 0,  /*!< Reset handler entered and cycle counter started */
+	BOOT_TIMELINE_SYSTEMINIT_ENTRY = 1,  /*!< systemInit entered */
+	BOOT_TIMELINE_SYSTEMINIT_EXIT  = 2,  /*!< systemInit about to return */
+	BOOT_TIMELINE_DATA_COPIED      = 3,  /*!< Copy table walked */
+	BOOT_TIMELINE_BSS_FILLED       = 4,  /*!< Zero table walked */
+	BOOT_TIMELINE_MAIN_ENTRY       = 5,  /*!< main entered */
+	BOOT_TIMELINE_PHASE_NUMBER     = 6   /*!< Number of phases */
+} boot_timeline_phase;
+
+/**
+ * @brief Boot timeline entry
+ *        Layout must be kept in sync with the host decoder (script/boot_timeline/decode_boot_timeline.py)
+ */
+typedef struct {
+	uint32_t sequence;                           /*!< Boot number since the ring was initialized */
+	uint32_t reset_cause;                        /*!< Value of the RCC reset status register (RSR) */
+	uint32_t stamps[BOOT_TIMELINE_PHASE_NUMBER]; /*!< Value of the cycle counter at each boot phase */
+} boot_timeline_entry;
+
+/**
+ * @brief Boot timeline ring
+ */
+typedef struct {
+	uint32_t magic;                                   /*!< Equal to BOOT_TIMELINE_MAGIC if the ring is valid */
+	uint32_t head;                                    /*!< Index of the entry that will be written by the next boot */
+	uint32_t sequence;                                /*!< Sequence number of the next boot */
+	boot_timeline_entry entries[BOOT_TIMELINE_DEPTH]; /*!< Boot entries */
+} boot_timeline_ring;
+
+/**
+ * @brief Ring of the last boots
+ *        It is stored in section .bkpsram_noinit
+ */
+extern boot_timeline_ring boot_timeline;
+
+/**
+ * @brief Function: bootTimelineStamp
+ *
+ * \param phase: boot phase that has just been reached
+ *
+ * Record the value of the cycle counter for the current boot
+ * It is called by the reset handler hence it does not access any initialized or uninitialized data
+ */
+void bootTimelineStamp(boot_timeline_phase phase);
+
+/**
+ * @brief Function: boot_timeline_commit
+ *
+ * Record the main entry, append the current boot to the ring in the backup SRAM and clear the reset flags
+ * It must be called once at the beginning of main
+ */
+void boot_timeline_commit(void);
+
+/** @} */ // End of BootTimelineGroup group
+
+#endif // BOOT_TIMELINE_H
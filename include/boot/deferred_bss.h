@@ -0,0 +1,74 @@
+#ifndef DEFERRED_BSS_H
+#define DEFERRED_BSS_H
+/**
+ * @copyright
+ * @file deferred_bss.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Deferred uninitialized data function signatures
+ *        Variables placed in section .bss_deferred are not cleared by the startup code.
+ *        They are filled with zeros by the master direct memory access (MDMA) controller after main is entered.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ *  @defgroup DeferredBssGroup Deferred uninitialized data macros, structure and functions
+ *  @brief Deferred uninitialized data macros, structure and functions
+ *  @{
+ */
+
+/*!< MDMA channel reserved for filling section .bss_deferred */
+#define DEFERRED_BSS_MDMA_CHANNEL 0U
+
+/*!< Size in bytes of a block transferred by the MDMA. It must match the alignment of section .bss_deferred in the linker script */
+#define DEFERRED_BSS_BLOCK_SIZE 256U
+
+/*!< Size in bytes of the MDMA internal buffer transfer */
+#define DEFERRED_BSS_BUFFER_LENGTH 128U
+
+/*!< Wait until variable VAR has been cleared */
+#define DEFERRED_BSS_WAIT(VAR) \
+	deferred_bss_wait(&(VAR), sizeof(VAR))
+
+/**
+ * @brief Function: deferred_bss_start
+ *
+ * Start filling section .bss_deferred with zeros in background
+ * It must be called once after main is entered
+ */
+void deferred_bss_start(void);
+
+/**
+ * @brief Function: deferred_bss_is_ready
+ *
+ * \param buffer: start address of the buffer
+ * \param size: size of the buffer in bytes
+ *
+ * \return true if the whole buffer has been cleared, false otherwise
+ *
+ * Buffers outside section .bss_deferred are always ready
+ */
+bool deferred_bss_is_ready(const void * buffer, uint32_t size);
+
+/**
+ * @brief Function: deferred_bss_wait
+ *
+ * \param buffer: start address of the buffer
+ * \param size: size of the buffer in bytes
+ *
+ * Wait until the whole buffer has been cleared. The remainder of section .bss_deferred may still be in progress on return
+ */
+void deferred_bss_wait(const void * buffer, uint32_t size);
+
+/**
+ * @brief Function: deferred_bss_wait_all
+ *
+ * Wait until the whole section .bss_deferred has been cleared
+ */
+void deferred_bss_wait_all(void);
+
+/** @} */ // End of DeferredBssGroup group
+
+#endif // DEFERRED_BSS_H
@@ -0,0 +1,82 @@
+#ifndef FIRMWARE_DELTA_H
+#define FIRMWARE_DELTA_H
+/**
+ * @copyright
+ * @file firmware_delta.h
+ * @author Andrea Gianarda
+ * @date 18th of October 2026
+ * @brief Firmware delta patch function signatures
+ *        A delta patch rebuilds the new image from the running one. It is decoded as it is received and the new image is streamed into the inactive bank through the firmware update functions
+ *        The patch is made by script/firmware_delta/make_firmware_delta.py. Format must be kept in sync with it:
+ *        - header: magic, checksum of the running image and size of the new image as 32-bit little endian words
+ *        - commands until the whole new image has been produced. Each command is an opcode followed by its arguments. Lengths and offsets are unsigned LEB128 numbers
+ *          - FIRMWARE_DELTA_OPCODE_COPY offset length: copy length bytes of the running image starting at offset
+ *          - FIRMWARE_DELTA_OPCODE_LITERAL length bytes: copy length bytes that follow in the patch
+ *          - FIRMWARE_DELTA_OPCODE_FILL value length: repeat byte value length times
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ *  @defgroup FirmwareDeltaGroup Firmware delta patch macros, structure and functions
+ *  @brief Firmware delta patch macros, structure and functions
+ *  @{
+ */
+
+/*!< First word of a delta patch ("WSDP" in ASCII) */
+#define FIRMWARE_DELTA_MAGIC 0x50445357UL
+
+/*!< Size of the header in bytes */
+#define FIRMWARE_DELTA_HEADER_SIZE 12U
+
+/*!< Opcodes of the commands */
+#define FIRMWARE_DELTA_OPCODE_COPY    0x00U
+#define FIRMWARE_DELTA_OPCODE_LITERAL 0x01U
+#define FIRMWARE_DELTA_OPCODE_FILL    0x02U
+
+/*!< Size in bytes of the buffer the repeated byte of a fill command is expanded into */
+#define FIRMWARE_DELTA_FILL_SIZE 32U
+
+/**
+ * @brief Delta patch status
+ */
+typedef enum {
+	FIRMWARE_DELTA_STATUS_IDLE,            /*!< No patch has been started */
+	FIRMWARE_DELTA_STATUS_APPLYING,        /*!< Patch is being decoded */
+	FIRMWARE_DELTA_STATUS_COMPLETE,        /*!< Whole new image has been queued. Its checksum is checked by firmware_update_verify */
+	FIRMWARE_DELTA_STATUS_BAD_MAGIC,       /*!< Data is not a delta patch */
+	FIRMWARE_DELTA_STATUS_BASE_MISMATCH,   /*!< Patch has been made from another image than the running one or the running image has not been verified */
+	FIRMWARE_DELTA_STATUS_CORRUPT,         /*!< Unknown opcode, a number does not fit 32 bits or a command reaches beyond the running or the new image */
+	FIRMWARE_DELTA_STATUS_UPDATE_ERROR     /*!< Firmware update stopped receiving the new image. Its cause is reported by firmware_update_get_status */
+} firmware_delta_status;
+
+/**
+ * @brief Function: firmware_delta_begin
+ *
+ * \return true if the patch can be received, false if the firmware update could not be started
+ */
+bool firmware_delta_begin(void);
+
+/**
+ * @brief Function: firmware_delta_write
+ *
+ * \param data: next chunk of the patch
+ * \param size: size of the chunk in bytes
+ * \return number of bytes of the patch consumed. The remainder must be written again once the flash writer has made room
+ *
+ * It never waits for the flash. Copy and fill commands may still be producing bytes once the whole chunk has been consumed
+ * hence it must be called with a size of 0 until the status changes from FIRMWARE_DELTA_STATUS_APPLYING once the whole patch has been written
+ */
+uint32_t firmware_delta_write(const void * data, uint32_t size);
+
+/**
+ * @brief Function: firmware_delta_get_status
+ *
+ * \return status of the patch
+ */
+firmware_delta_status firmware_delta_get_status(void);
+
+/** @} */ // End of FirmwareDeltaGroup group
+
+#endif // FIRMWARE_DELTA_H
@@ -0,0 +1,107 @@
+#ifndef FIRMWARE_UPDATE_H
+#define FIRMWARE_UPDATE_H
+/**
+ * @copyright
+ * @file firmware_update.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Firmware update function signatures
+ *        The new image is streamed into the lower sectors of bank 2 by the flash writer while the current image keeps running from bank 1
+ *        Once its checksum has been verified by the flash CRC unit, the swap bank option bit is toggled and the system is reset. Bank 2 is then mapped at the start of the flash memory
+ *        The stream is the binary patched by script/image_crc/patch_image_crc.py hence it ends with the checksum of the image
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "storage/flash_writer.h"
+
+/**
+ *  @defgroup FirmwareUpdateGroup Firmware update macros, structure and functions
+ *  @brief Firmware update macros, structure and functions
+ *  @{
+ */
+
+/*!< Start address of the new image. It is the start of the inactive bank */
+#define FIRMWARE_UPDATE_START FLASH_WRITER_BANK2_BASE
+
+/*!< Largest image in bytes. Sectors above it hold the log */
+#define FIRMWARE_UPDATE_SIZE_MAX (FLASH_WRITER_FIRST_SECTOR * FLASH_WRITER_SECTOR_SIZE)
+
+/**
+ * @brief Firmware update status
+ */
+typedef enum {
+	FIRMWARE_UPDATE_STATUS_IDLE,          /*!< No update has been started */
+	FIRMWARE_UPDATE_STATUS_RECEIVING,     /*!< Image is being streamed into bank 2 */
+	FIRMWARE_UPDATE_STATUS_PROGRAMMING,   /*!< Whole image has been received and flash words are still being programmed */
+	FIRMWARE_UPDATE_STATUS_VALID,         /*!< Computed checksum matches the one stored at the end of the image */
+	FIRMWARE_UPDATE_STATUS_MISMATCH,      /*!< Computed checksum differs from the one stored at the end of the image */
+	FIRMWARE_UPDATE_STATUS_READ_ERROR,    /*!< CRC unit reported a read error */
+	FIRMWARE_UPDATE_STATUS_WRITE_ERROR,   /*!< Image is too short or too long or an erase or a program operation failed */
+	FIRMWARE_UPDATE_STATUS_SWAP_ERROR     /*!< Option bytes could not be changed */
+} firmware_update_status;
+
+/**
+ * @brief Function: firmware_update_begin
+ *
+ * \return true if the update has started, false if flash words of a previous update are still being programmed
+ *
+ * Sectors of bank 2 are erased as the image reaches them
+ */
+bool firmware_update_begin(void);
+
+/**
+ * @brief Function: firmware_update_write
+ *
+ * \param data: next chunk of the image
+ * \param size: size of the chunk in bytes
+ * \return number of bytes accepted. The remainder must be written again once the flash writer has made room
+ *
+ * It never waits for the flash
+ */
+uint32_t firmware_update_write(const void * data, uint32_t size);
+
+/**
+ * @brief Function: firmware_update_end
+ *
+ * \return true if the whole image has been queued, false if the last flash word has to be queued again
+ */
+bool firmware_update_end(void);
+
+/**
+ * @brief Function: firmware_update_verify
+ *
+ * \return status of the update
+ *
+ * Once the image has been programmed, compute its checksum with the CRC unit of bank 2 and compare it with the last word of the image
+ * It returns FIRMWARE_UPDATE_STATUS_PROGRAMMING without waiting while bank 2 is busy with flash words of any stream. Log data is queued and not programmed while the checksum is computed
+ */
+firmware_update_status firmware_update_verify(void);
+
+/**
+ * @brief Function: firmware_update_activate
+ *
+ * \return false if the image has not been verified or the option bytes could not be changed. It does not return otherwise
+ *
+ * Program pending log data, toggle the swap bank option bit and reset the system
+ */
+bool firmware_update_activate(void);
+
+/**
+ * @brief Function: firmware_update_get_status
+ *
+ * \return status of the update
+ */
+firmware_update_status firmware_update_get_status(void);
+
+/**
+ * @brief Function: firmware_update_is_swapped
+ *
+ * \return true if the running image has been booted from bank 2 mapped at the start of the flash memory
+ */
+bool firmware_update_is_swapped(void);
+
+/** @} */ // End of FirmwareUpdateGroup group
+
+#endif // FIRMWARE_UPDATE_H
@@ -0,0 +1,105 @@
+#ifndef IMAGE_CRC_H
+#define IMAGE_CRC_H
+/**
+ * @copyright
+ * @file image_crc.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Firmware image verification function signatures
+ *        The CRC unit of the flash interface computes the checksum of the image while the startup code initializes memory
+ *        The expected checksum is stored right after the image by script/image_crc/patch_image_crc.py
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "registers/peripheral/flash.h"
+
+/**
+ *  @defgroup ImageCrcGroup Image CRC macros, structure and functions
+ *  @brief Image CRC macros, structure and functions
+ *  @{
+ */
+
+/*!< Start address of flash bank 1 */
+#define IMAGE_CRC_BANK1_START 0x08000000UL
+
+/*!< Size of flash bank 1 in bytes */
+#define IMAGE_CRC_BANK1_SIZE 0x00100000UL
+
+/*!< Polynomial of the flash CRC unit */
+#define IMAGE_CRC_POLYNOMIAL 0x04C11DB7UL
+
+/*!< Initial value of the flash CRC unit */
+#define IMAGE_CRC_INIT 0xFFFFFFFFUL
+
+/*!< Value of the checksum word when it has not been stored by the post-build script (erased flash) */
+#define IMAGE_CRC_NOT_STORED 0xFFFFFFFFUL
+
+/**
+ * @brief Image verification status
+ */
+typedef enum {
+	IMAGE_CRC_STATUS_PENDING,      /*!< Computation has not been checked yet */
+	IMAGE_CRC_STATUS_VALID,        /*!< Computed checksum matches the stored one */
+	IMAGE_CRC_STATUS_MISMATCH,     /*!< Computed checksum differs from the stored one */
+	IMAGE_CRC_STATUS_READ_ERROR,   /*!< CRC unit reported a read error */
+	IMAGE_CRC_STATUS_NOT_STORED    /*!< Image has not been patched with its checksum */
+} image_crc_status;
+
+/**
+ * @brief Function: imageCrcStart
+ *
+ * Start the computation of the checksum of the image with the flash CRC unit. It is called by systemInit
+ */
+void imageCrcStart(void);
+
+/**
+ * @brief Function: image_crc_unit_start
+ *
+ * \param bank: flash bank (FLASH_BANK1 or FLASH_BANK2)
+ * \param start: offset of the first byte from the start of the bank
+ * \param end: offset of the last 32-bit word from the start of the bank
+ *
+ * Unlock the flash bank and start its CRC unit over the address range between start and end
+ */
+void image_crc_unit_start(flash_bank_regs * bank, uint32_t start, uint32_t end);
+
+/**
+ * @brief Function: image_crc_unit_wait
+ *
+ * \param bank: flash bank passed to image_crc_unit_start
+ * \param crc: pointer to the computed checksum
+ * \return true if the computation completed without read errors, false otherwise
+ *
+ * Wait for the end of the computation started by image_crc_unit_start then disable the CRC unit
+ * The flash bank is locked again only if image_crc_unit_start unlocked it
+ */
+bool image_crc_unit_wait(flash_bank_regs * bank, uint32_t * crc);
+
+/**
+ * @brief Function: image_crc_check
+ *
+ * \return status of the image verification
+ *
+ * Wait for the computation started by imageCrcStart and compare the result with the stored checksum
+ */
+image_crc_status image_crc_check(void);
+
+/**
+ * @brief Function: image_crc_get_status
+ *
+ * \return status of the image verification returned by the last call to image_crc_check
+ */
+image_crc_status image_crc_get_status(void);
+
+/**
+ * @brief Function: image_crc_get_wait_cycles
+ *
+ * \return number of core clock cycles image_crc_check waited for the CRC unit to complete
+ */
+uint32_t image_crc_get_wait_cycles(void);
+
+/** @} */ // End of ImageCrcGroup group
+
+#endif // IMAGE_CRC_H
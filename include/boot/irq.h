@@ -0,0 +1,65 @@
+#ifndef IRQ_H
+#define IRQ_H
+/**
+ * @copyright
+ * @file irq.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Interrupt ownership macros and function signatures
+ *        Each driver declares the interrupts it owns with IRQ_DECLARE. The linker collects the declarations in a constant table that is used to
+ *        configure the nested vectored interrupt controller (NVIC) at boot
+ */
+
+#include <stdint.h>
+
+#include "global/interrupts.h"
+
+/**
+ *  @defgroup IrqGroup Interrupt ownership macros, structure and functions
+ *  @brief Interrupt ownership macros, structure and functions
+ *  @{
+ */
+
+/*!< Number of priority bits implemented by the NVIC. They are the most significant bits of the priority byte */
+#define IRQ_PRIORITY_BITS 4U
+
+/*!< Lowest priority */
+#define IRQ_PRIORITY_LOWEST ((1U << IRQ_PRIORITY_BITS) - 1U)
+
+/**
+ * @brief Declare that the driver owns interrupt IRQ_NAME and that NAME_irq_handler handles it
+ *
+ *        NAME_irq_handler overrides the weak alias to the default handler in boot.s hence the vector table points directly to it.
+ *        Declaring the same interrupt twice defines symbol irq_owner_NAME twice and the link fails
+ *
+ * \param NAME: prefix of the handler name in boot.s (e.g. DMA1_Stream0)
+ * \param PRIORITY: priority from 0 (highest) to IRQ_PRIORITY_LOWEST
+ */
+#define IRQ_DECLARE(NAME, PRIORITY) \
+	_Static_assert(IRQ_ ## NAME >= 0, "Only external interrupts can be declared"); \
+	_Static_assert((PRIORITY) <= IRQ_PRIORITY_LOWEST, "Priority of " #NAME " is out of range"); \
+	void NAME ## _irq_handler(void); \
+	const irq_config irq_owner_ ## NAME __attribute__((section(".irq_config." #NAME), used)) = { \
+		.irq = IRQ_ ## NAME, \
+		.priority = (PRIORITY) \
+	}
+
+/**
+ * @brief Interrupt configuration
+ */
+typedef struct {
+	irq_number irq;     /*!< Interrupt number */
+	uint32_t priority;  /*!< Priority */
+} irq_config;
+
+/**
+ * @brief Function: irq_config_apply
+ *
+ * Set the priority of every declared interrupt and enable it in the NVIC
+ * Interrupts are enabled in the NVIC only: each driver still has to enable the interrupt in its peripheral
+ */
+void irq_config_apply(void);
+
+/** @} */ // End of IrqGroup group
+
+#endif // IRQ_H
@@ -0,0 +1,79 @@
+#ifndef PLL_H
+#define PLL_H
+/**
+ * @copyright
+ * @file pll.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief PLL configuration
+ *        Dividers are computed by script/pll/pll_solver.py for each clock profile. Run make pll_config to update them
+ *        Reference clock and VCO frequencies are checked at compile time
+ */
+
+#include "registers/peripheral/rcc.h"
+
+#ifdef SUPPLY_LDO
+#include "boot/pll_config_ldo.h"
+#else
+#include "boot/pll_config_smps.h"
+#endif // SUPPLY_LDO
+
+/**
+ *  @defgroup PllGroup PLL macros
+ *  @brief PLL macros
+ *  @{
+ */
+
+/*!< Number of steps of the fractional part of the multiplication factor */
+#define PLL_FRACN_STEPS 8192ULL
+
+/*!< Reference clock range in Hz */
+#define PLL_REF_MIN_FREQ 1000000ULL
+#define PLL_REF_MAX_FREQ 16000000ULL
+
+/*!< Wide VCO range in Hz. It requires a reference clock of 2 MHz at least */
+#define PLL_VCO_WIDE_MIN_REF_FREQ 2000000ULL
+#define PLL_VCO_WIDE_MIN_FREQ 192000000ULL
+#define PLL_VCO_WIDE_MAX_FREQ 960000000ULL
+
+/*!< Medium VCO range in Hz */
+#define PLL_VCO_MEDIUM_MIN_FREQ 150000000ULL
+#define PLL_VCO_MEDIUM_MAX_FREQ 420000000ULL
+
+/*!< Reference clock of a PLL in Hz */
+#define PLL_REF_FREQ(PLL) \
+	((unsigned long long)PLL_INPUT_FREQ / PLL ## _DIVM)
+
+/*!< VCO frequency of a PLL in Hz */
+#define PLL_VCO_FREQ(PLL) \
+	(((unsigned long long)PLL_INPUT_FREQ * ((PLL ## _DIVN * PLL_FRACN_STEPS) + PLL ## _FRACN)) / (PLL ## _DIVM * PLL_FRACN_STEPS))
+
+/*!< Output frequencies of a PLL in Hz */
+#define PLL_P_FREQ(PLL) (PLL_VCO_FREQ(PLL) / PLL ## _DIVP)
+#define PLL_Q_FREQ(PLL) (PLL_VCO_FREQ(PLL) / PLL ## _DIVQ)
+#define PLL_R_FREQ(PLL) (PLL_VCO_FREQ(PLL) / PLL ## _DIVR)
+
+/*!< Check the configuration of a PLL. Range PLLxRGE covers reference clocks from (1 MHz << PLLxRGE) to (2 MHz << PLLxRGE) */
+#define PLL_CHECK(PLL) \
+	_Static_assert((PLL ## _DIVM >= 1UL) && (PLL ## _DIVM <= 63UL), #PLL " DIVM is out of range"); \
+	_Static_assert((PLL ## _DIVN >= 4UL) && (PLL ## _DIVN <= 512UL), #PLL " DIVN is out of range"); \
+	_Static_assert((PLL ## _DIVP >= 1UL) && (PLL ## _DIVP <= 128UL), #PLL " DIVP is out of range"); \
+	_Static_assert((PLL ## _DIVQ >= 1UL) && (PLL ## _DIVQ <= 128UL), #PLL " DIVQ is out of range"); \
+	_Static_assert((PLL ## _DIVR >= 1UL) && (PLL ## _DIVR <= 128UL), #PLL " DIVR is out of range"); \
+	_Static_assert(PLL ## _FRACN < PLL_FRACN_STEPS, #PLL " FRACN is out of range"); \
+	_Static_assert((PLL ## _FRACN == 0UL) || (PLL ## _FRACEN == RCC_PLLFRAC_ENABLE), #PLL " FRACN requires the fractional divider"); \
+	_Static_assert((PLL_REF_FREQ(PLL) >= PLL_REF_MIN_FREQ) && (PLL_REF_FREQ(PLL) <= PLL_REF_MAX_FREQ), #PLL " reference clock is out of range"); \
+	_Static_assert((PLL_REF_FREQ(PLL) >= (PLL_REF_MIN_FREQ << PLL ## _RGE)) && (PLL_REF_FREQ(PLL) <= ((2ULL * PLL_REF_MIN_FREQ) << PLL ## _RGE)), #PLL " RGE does not match the reference clock"); \
+	_Static_assert((PLL ## _VCOSEL != RCC_PLLVCOSEL_WIDE) || ((PLL_REF_FREQ(PLL) >= PLL_VCO_WIDE_MIN_REF_FREQ) && (PLL_VCO_FREQ(PLL) >= PLL_VCO_WIDE_MIN_FREQ) && (PLL_VCO_FREQ(PLL) <= PLL_VCO_WIDE_MAX_FREQ)), #PLL " VCO is out of the wide range"); \
+	_Static_assert((PLL ## _VCOSEL != RCC_PLLVCOSEL_MEDIUM) || ((PLL_VCO_FREQ(PLL) >= PLL_VCO_MEDIUM_MIN_FREQ) && (PLL_VCO_FREQ(PLL) <= PLL_VCO_MEDIUM_MAX_FREQ)), #PLL " VCO is out of the medium range")
+
+PLL_CHECK(PLL1);
+PLL_CHECK(PLL2);
+PLL_CHECK(PLL3);
+
+// Odd values of the P divider of PLL1 are not allowed
+_Static_assert((PLL1_DIVP % 2UL) == 0UL, "PLL1 DIVP must be even");
+
+/** @} */ // End of PllGroup group
+
+#endif // PLL_H
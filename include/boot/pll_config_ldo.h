@@ -0,0 +1,52 @@
+#ifndef PLL_CONFIG_LDO_H
+#define PLL_CONFIG_LDO_H
+/**
+ * @copyright
+ * @file pll_config_ldo.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief PLL dividers of clock profile ldo
+ *        Generated by script/pll/pll_solver.py: ldo --source HSI --pll1 480000000,240000000,480000000 --pll2 129000000 --pll3 129000000 --fractional 2,3 --output include/boot/pll_config_ldo.h
+ *        Do not edit by hand
+ */
+
+/*!< PLL source clock */
+#define PLL_SOURCE RCC_PLLSRC_HSI
+
+/*!< Frequency of the PLL source clock in Hz */
+#define PLL_INPUT_FREQ 64000000UL
+
+/*!< PLL1: reference clock 16000000 Hz, VCO 960000000 Hz, outputs P 480000000 Hz, Q 240000000 Hz, R 480000000 Hz */
+#define PLL1_DIVM 4UL
+#define PLL1_DIVN 60UL
+#define PLL1_FRACN 0UL
+#define PLL1_DIVP 2UL
+#define PLL1_DIVQ 4UL
+#define PLL1_DIVR 2UL
+#define PLL1_RGE RCC_PLLFREQRANGE_8_16MHZ
+#define PLL1_VCOSEL RCC_PLLVCOSEL_WIDE
+#define PLL1_FRACEN RCC_PLLFRAC_DISABLE
+
+/*!< PLL2: reference clock 4000000 Hz, VCO 516000000 Hz, outputs P 129000000 Hz, Q 129000000 Hz, R 129000000 Hz */
+#define PLL2_DIVM 16UL
+#define PLL2_DIVN 129UL
+#define PLL2_FRACN 0UL
+#define PLL2_DIVP 4UL
+#define PLL2_DIVQ 4UL
+#define PLL2_DIVR 4UL
+#define PLL2_RGE RCC_PLLFREQRANGE_2_4MHZ
+#define PLL2_VCOSEL RCC_PLLVCOSEL_WIDE
+#define PLL2_FRACEN RCC_PLLFRAC_ENABLE
+
+/*!< PLL3: reference clock 4000000 Hz, VCO 516000000 Hz, outputs P 129000000 Hz, Q 129000000 Hz, R 129000000 Hz */
+#define PLL3_DIVM 16UL
+#define PLL3_DIVN 129UL
+#define PLL3_FRACN 0UL
+#define PLL3_DIVP 4UL
+#define PLL3_DIVQ 4UL
+#define PLL3_DIVR 4UL
+#define PLL3_RGE RCC_PLLFREQRANGE_2_4MHZ
+#define PLL3_VCOSEL RCC_PLLVCOSEL_WIDE
+#define PLL3_FRACEN RCC_PLLFRAC_ENABLE
+
+#endif // PLL_CONFIG_LDO_H
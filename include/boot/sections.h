@@ -0,0 +1,56 @@
+#ifndef SECTIONS_H
+#define SECTIONS_H
+/**
+ * @copyright
+ * @file sections.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Memory section attributes
+ *        Each macro places a variable into a section of the linker script. Sections are listed in the copy and zero tables walked by the startup code
+ */
+
+/**
+ *  @defgroup SectionsGroup Memory section macros
+ *  @brief Memory section macros
+ *  @{
+ */
+
+#define SECTION(NAME) __attribute__((section(NAME)))
+
+/*!< Code copied from the flash at startup and executed with no wait states
+ *   Functions are called through a register as the ITCM is out of the range of a branch from the flash */
+#define ITCM_FUNC     __attribute__((section(".itcm_text"), noinline, long_call))
+
+/*!< Initialized data: copied from the flash at startup */
+#define ITCM_DATA     SECTION(".itcm_data")
+#define DTCM_DATA     SECTION(".dtcm_data")
+#define SRAM1_DATA    SECTION(".sram1_data")
+#define SRAM2_DATA    SECTION(".sram2_data")
+#define SRAM3_DATA    SECTION(".sram3_data")
+#define SRAM4_DATA    SECTION(".sram4_data")
+#define BKPSRAM_DATA  SECTION(".bkpsram_data")
+
+/*!< Read only data: lookup tables copied from the flash at startup in order to be read with no wait states */
+#define DTCM_RODATA   SECTION(".dtcm_rodata")
+
+/*!< Uninitialized data: filled with zeros at startup */
+#define ITCM_BSS      SECTION(".itcm_bss")
+#define DTCM_BSS      SECTION(".dtcm_bss")
+#define SRAM1_BSS     SECTION(".sram1_bss")
+#define SRAM2_BSS     SECTION(".sram2_bss")
+#define SRAM3_BSS     SECTION(".sram3_bss")
+#define SRAM4_BSS     SECTION(".sram4_bss")
+#define BKPSRAM_BSS   SECTION(".bkpsram_bss")
+
+/*!< Uninitialized data filled with zeros by the MDMA after main is entered (see boot/deferred_bss.h) */
+#define DEFERRED_BSS  SECTION(".bss_deferred")
+
+/*!< Data left untouched by the startup code */
+#define NOINIT        SECTION(".noinit")
+
+/*!< Data left untouched by the startup code and retained in the backup SRAM across system resets */
+#define BKPSRAM_NOINIT SECTION(".bkpsram_noinit")
+
+/** @} */ // End of SectionsGroup group
+
+#endif // SECTIONS_H
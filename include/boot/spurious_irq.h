@@ -0,0 +1,78 @@
+#ifndef SPURIOUS_IRQ_H
+#define SPURIOUS_IRQ_H
+/**
+ * @copyright
+ * @file spurious_irq.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Spurious interrupt accounting function signatures
+ *        Interrupts without a handler are counted by the default interrupt handler. An interrupt firing too often is disabled in the nested vectored
+ *        interrupt controller (NVIC) so that an interrupt storm costs CPU time instead of hanging the system
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "global/interrupts.h"
+
+/**
+ *  @defgroup SpuriousIrqGroup Spurious interrupt accounting macros, structure and functions
+ *  @brief Spurious interrupt accounting macros, structure and functions
+ *  @{
+ */
+
+/*!< Number of entries of the vector table */
+#define SPURIOUS_IRQ_VECTORS (IRQ_SYSTEM_EXCEPTIONS + IRQ_NUMBER)
+
+/*!< Length of the rate limiting window in core clock cycles */
+#define SPURIOUS_IRQ_WINDOW_CYCLES 1000000UL
+
+/*!< Maximum number of occurrences of an interrupt in a window. The interrupt is disabled when it fires once more */
+#define SPURIOUS_IRQ_STORM_THRESHOLD 100U
+
+/**
+ * @brief Spurious interrupt statistics of a vector
+ */
+typedef struct {
+	uint32_t count;         /*!< Number of occurrences since boot */
+	uint32_t window_start;  /*!< Value of the cycle counter at the beginning of the current window */
+	uint16_t window_count;  /*!< Number of occurrences in the current window */
+	uint16_t disabled;      /*!< Not 0 if the interrupt has been disabled because of a storm */
+} spurious_irq_stats;
+
+/**
+ * @brief Function: spuriousInterruptHandler
+ *
+ * Account for an exception taken by the default interrupt handler in boot.s
+ * Faults and the non maskable interrupt keep the core in an infinite loop to allow the debugger to examine the system state
+ */
+void spuriousInterruptHandler(void);
+
+/**
+ * @brief Function: spurious_irq_count
+ *
+ * \param irq: interrupt number
+ *
+ * \return number of times the interrupt has been taken by the default interrupt handler since boot
+ */
+uint32_t spurious_irq_count(irq_number irq);
+
+/**
+ * @brief Function: spurious_irq_is_disabled
+ *
+ * \param irq: interrupt number
+ *
+ * \return true if the interrupt has been disabled because of a storm, false otherwise
+ */
+bool spurious_irq_is_disabled(irq_number irq);
+
+/**
+ * @brief Function: spurious_irq_total
+ *
+ * \return number of spurious interrupts taken since boot across all vectors
+ */
+uint32_t spurious_irq_total(void);
+
+/** @} */ // End of SpuriousIrqGroup group
+
+#endif // SPURIOUS_IRQ_H
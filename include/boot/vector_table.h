@@ -0,0 +1,58 @@
+#ifndef VECTOR_TABLE_H
+#define VECTOR_TABLE_H
+/**
+ * @copyright
+ * @file vector_table.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Vector table function signatures
+ *        The vector table is copied from the flash to the data tightly coupled memory (DTCM) at startup so that handlers can be changed at runtime
+ */
+
+#include <stdint.h>
+
+#include "global/interrupts.h"
+
+/**
+ *  @defgroup VectorTableGroup Vector table macros, structure and functions
+ *  @brief Vector table macros, structure and functions
+ *  @{
+ */
+
+/**
+ * @brief Interrupt handler
+ */
+typedef void (*vector_handler)(void);
+
+/**
+ * @brief Function: vector_table_install
+ *
+ * Point the vector table offset register (VTOR) to the copy of the vector table in the DTCM
+ * It must be called once after the startup code has copied the vector table
+ */
+void vector_table_install(void);
+
+/**
+ * @brief Function: vector_table_set_handler
+ *
+ * \param irq: interrupt whose handler is changed
+ * \param handler: new handler
+ *
+ * \return previous handler
+ *
+ * The new handler is used from the next exception entry. A single word is written hence it can be changed while the interrupt is enabled
+ */
+vector_handler vector_table_set_handler(irq_number irq, vector_handler handler);
+
+/**
+ * @brief Function: vector_table_get_handler
+ *
+ * \param irq: interrupt
+ *
+ * \return current handler
+ */
+vector_handler vector_table_get_handler(irq_number irq);
+
+/** @} */ // End of VectorTableGroup group
+
+#endif // VECTOR_TABLE_H
@@ -0,0 +1,128 @@
+#ifndef WARM_BOOT_H
+#define WARM_BOOT_H
+/**
+ * @copyright
+ * @file warm_boot.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Warm boot function signatures
+ *        After a software or watchdog reset, the clock tree and the sensor calibration saved in the backup SRAM are restored as they are
+ *        instead of being computed and configured again
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ *  @defgroup WarmBootGroup Warm boot macros, structure and functions
+ *  @brief Warm boot macros, structure and functions
+ *  @{
+ */
+
+/*!< Value of the state magic word once it has been saved ("WARM" in ASCII) */
+#define WARM_BOOT_MAGIC 0x5741524DUL
+
+/*!< Number of words of sensor calibration that can be cached */
+#define WARM_BOOT_CALIBRATION_WORDS 32U
+
+/**
+ * @brief Clock tree snapshot
+ *        Values of the reset and clock control (RCC) and flash registers once the clock tree has been configured
+ */
+typedef struct {
+	uint32_t cr;         /*!< Oscillators and PLLs enables */
+	uint32_t cfgr;       /*!< System clock source */
+	uint32_t d1cfgr;     /*!< Domain D1 prescalers */
+	uint32_t d2cfgr;     /*!< Domain D2 prescalers */
+	uint32_t d3cfgr;     /*!< Domain D3 prescalers */
+	uint32_t pllckselr;  /*!< PLL source and prescalers */
+	uint32_t pllcfgr;    /*!< PLL configuration */
+	uint32_t pll1divr;   /*!< PLL1 dividers */
+	uint32_t pll1fracr;  /*!< PLL1 fractional divider */
+	uint32_t pll2divr;   /*!< PLL2 dividers */
+	uint32_t pll2fracr;  /*!< PLL2 fractional divider */
+	uint32_t pll3divr;   /*!< PLL3 dividers */
+	uint32_t pll3fracr;  /*!< PLL3 fractional divider */
+	uint32_t flash_acr;  /*!< Flash latency and programming delay */
+} warm_boot_clock_snapshot;
+
+/**
+ * @brief Warm boot state
+ *        It is stored in section .bkpsram_noinit hence it is retained across system resets
+ */
+typedef struct {
+	uint32_t magic;                                       /*!< Equal to WARM_BOOT_MAGIC if the state has been saved */
+	warm_boot_clock_snapshot clock;                       /*!< Clock tree snapshot */
+	uint32_t calibration_words;                           /*!< Number of valid words in the calibration cache */
+	uint32_t calibration[WARM_BOOT_CALIBRATION_WORDS];    /*!< Sensor calibration cache */
+	uint32_t checksum;                                    /*!< Checksum of all the fields above */
+} warm_boot_state;
+
+/**
+ * @brief Function: warmBootDetect
+ *
+ * \return true if the reset is a software or watchdog reset and the warm boot state is valid, false otherwise
+ *
+ * It is called by systemInit before the data and uninitialized data sections are initialized. The backup SRAM clock must be enabled
+ */
+bool warmBootDetect(void);
+
+/**
+ * @brief Function: warmBootRestoreClock
+ *
+ * Restore the configuration of oscillators and PLLs from the snapshot and turn them on. It is called by systemInit on a warm boot
+ */
+void warmBootRestoreClock(void);
+
+/**
+ * @brief Function: warmBootRestoreBus
+ *
+ * Restore bus prescalers, system clock source and flash latency from the snapshot. It is called by systemClockSwitch on a warm boot once PLLs are locked
+ */
+void warmBootRestoreBus(void);
+
+/**
+ * @brief Function: warm_boot_is_active
+ *
+ * \return true if the current boot is a warm boot, false otherwise
+ */
+bool warm_boot_is_active(void);
+
+/**
+ * @brief Function: warm_boot_save
+ *
+ * Take a snapshot of the clock tree and save it to the backup SRAM
+ * It must be called once the clock tree has been configured
+ */
+void warm_boot_save(void);
+
+/**
+ * @brief Function: warm_boot_invalidate
+ *
+ * Discard the snapshot saved in the backup SRAM hence the next reset is a cold boot
+ */
+void warm_boot_invalidate(void);
+
+/**
+ * @brief Function: warm_boot_calibration_load
+ *
+ * \param calibration: buffer where the cached calibration is copied to
+ * \param words: number of words to copy
+ *
+ * \return true if the cached calibration has been restored, false if the sensors must be calibrated again
+ *
+ * Cached calibration is only reused on a warm boot
+ */
+bool warm_boot_calibration_load(uint32_t * calibration, uint32_t words);
+
+/**
+ * @brief Function: warm_boot_calibration_store
+ *
+ * \param calibration: calibration to be cached
+ * \param words: number of words to cache. It must not be larger than WARM_BOOT_CALIBRATION_WORDS
+ */
+void warm_boot_calibration_store(const uint32_t * calibration, uint32_t words);
+
+/** @} */ // End of WarmBootGroup group
+
+#endif // WARM_BOOT_H
@@ -0,0 +1,110 @@
+#ifndef CLOCK_GATE_H
+#define CLOCK_GATE_H
+/**
+ * @copyright
+ * @file clock_gate.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Peripheral clock gating function signatures
+ *        Drivers acquire and release the bus clock of their peripherals. A clock is enabled while at least one driver holds it
+ *        Clocks in sleep mode (xxxLPENR) are held separately so that peripherals not needed while the core sleeps stop as well
+ *        Functions must not be called from interrupt handlers
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ *  @defgroup ClockGateGroup Clock gate macros, structure and functions
+ *  @brief Clock gate macros, structure and functions
+ *  @{
+ */
+
+/*!< Number of bits of a clock identifier storing the bit of the enable register */
+#define CLOCK_GATE_BUS_SHIFT 5U
+
+/*!< Mask of the bit of the enable register in a clock identifier */
+#define CLOCK_GATE_BIT_MASK 0x1FUL
+
+/*!< Clock identifier of a peripheral. For example CLOCK_GATE(AHB4, GPIOB) */
+#define CLOCK_GATE(BUS, PERIPHERAL) \
+	((CLOCK_GATE_BUS_ ## BUS << CLOCK_GATE_BUS_SHIFT) | RCC_ ## BUS ## ENR_ ## PERIPHERAL ## EN_OFFSET)
+
+/**
+ * @brief Buses
+ *        They are in the same order as the enable and low power enable registers
+ */
+typedef enum {
+	CLOCK_GATE_BUS_AHB3,    /*!< AHB3 */
+	CLOCK_GATE_BUS_AHB1,    /*!< AHB1 */
+	CLOCK_GATE_BUS_AHB2,    /*!< AHB2 */
+	CLOCK_GATE_BUS_AHB4,    /*!< AHB4 */
+	CLOCK_GATE_BUS_APB3,    /*!< APB3 */
+	CLOCK_GATE_BUS_APB1L,   /*!< APB1 low */
+	CLOCK_GATE_BUS_APB1H,   /*!< APB1 high */
+	CLOCK_GATE_BUS_APB2,    /*!< APB2 */
+	CLOCK_GATE_BUS_APB4,    /*!< APB4 */
+	CLOCK_GATE_BUS_NUMBER   /*!< Number of buses */
+} clock_gate_bus;
+
+/**
+ * @brief Clock identifier
+ *        Bus in the upper bits and bit of the enable register in the lower CLOCK_GATE_BUS_SHIFT bits
+ */
+typedef uint32_t clock_gate_id;
+
+/**
+ * @brief Clock report
+ *        Value of the enable and low power enable registers of each bus
+ */
+typedef struct {
+	uint32_t run[CLOCK_GATE_BUS_NUMBER];     /*!< Clocks enabled in run mode */
+	uint32_t sleep[CLOCK_GATE_BUS_NUMBER];   /*!< Clocks enabled in sleep mode */
+} clock_gate_report;
+
+/**
+ * @brief Function: clock_gate_init
+ *
+ * Clocks enabled by the startup code are held once in run and sleep mode on its behalf
+ * Other clocks in sleep mode are disabled except those of memories
+ */
+void clock_gate_init(void);
+
+/**
+ * @brief Function: clock_gate_acquire
+ *
+ * \param id: clock identifier
+ * \param sleep: true if the clock must run in sleep mode as well
+ *
+ * Enable the clock if it is the first hold
+ */
+void clock_gate_acquire(clock_gate_id id, bool sleep);
+
+/**
+ * @brief Function: clock_gate_release
+ *
+ * \param id: clock identifier
+ * \param sleep: value given to clock_gate_acquire
+ *
+ * Disable the clock if it is the last hold
+ */
+void clock_gate_release(clock_gate_id id, bool sleep);
+
+/**
+ * @brief Function: clock_gate_get_holds
+ *
+ * \param id: clock identifier
+ * \return number of holds of the clock in run mode
+ */
+uint32_t clock_gate_get_holds(clock_gate_id id);
+
+/**
+ * @brief Function: clock_gate_get_report
+ *
+ * \param report: clocks enabled in run and sleep mode
+ */
+void clock_gate_get_report(clock_gate_report * report);
+
+/** @} */ // End of ClockGateGroup group
+
+#endif // CLOCK_GATE_H
@@ -0,0 +1,73 @@
+#ifndef CLOCK_READY_H
+#define CLOCK_READY_H
+/**
+ * @copyright
+ * @file clock_ready.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Asynchronous oscillator and PLL start function signatures
+ *        An oscillator or a PLL is turned on with its ready interrupt enabled. RCC_irq_handler completes the start so that the core can carry on
+ *        or sleep while the clock stabilises
+ */
+
+#include <stdbool.h>
+
+/**
+ *  @defgroup ClockReadyGroup Clock ready macros, structure and functions
+ *  @brief Clock ready macros, structure and functions
+ *  @{
+ */
+
+/**
+ * @brief Clock sources
+ *        Values are the bits of the ready interrupt enable, flag and clear registers
+ */
+typedef enum {
+	CLOCK_READY_LSI,      /*!< LSI */
+	CLOCK_READY_LSE,      /*!< LSE. Backup domain must be write enabled */
+	CLOCK_READY_HSI,      /*!< HSI */
+	CLOCK_READY_HSE,      /*!< HSE */
+	CLOCK_READY_CSI,      /*!< CSI */
+	CLOCK_READY_HSI48,    /*!< HSI48 */
+	CLOCK_READY_PLL1,     /*!< PLL1 */
+	CLOCK_READY_PLL2,     /*!< PLL2 */
+	CLOCK_READY_PLL3,     /*!< PLL3 */
+	CLOCK_READY_NUMBER    /*!< Number of clock sources */
+} clock_ready_source;
+
+/**
+ * @brief Function called from RCC_irq_handler when a clock source is ready
+ */
+typedef void (*clock_ready_callback)(clock_ready_source source);
+
+/**
+ * @brief Function: clock_ready_start
+ *
+ * \param source: clock source to turn on
+ * \param callback: function called when the clock source is ready. It may be NULL
+ * \return true if the clock source is starting or already ready, false if the source does not exist or a start is already pending
+ *
+ * The callback is called immediately if the clock source is already ready
+ */
+bool clock_ready_start(clock_ready_source source, clock_ready_callback callback);
+
+/**
+ * @brief Function: clock_ready_is_pending
+ *
+ * \param source: clock source
+ * \return true if the clock source has been started and it is not ready yet
+ */
+bool clock_ready_is_pending(clock_ready_source source);
+
+/**
+ * @brief Function: clock_ready_wait
+ *
+ * \param source: clock source
+ *
+ * Sleep until the clock source started by clock_ready_start is ready. Interrupts must be enabled
+ */
+void clock_ready_wait(clock_ready_source source);
+
+/** @} */ // End of ClockReadyGroup group
+
+#endif // CLOCK_READY_H
@@ -0,0 +1,109 @@
+#ifndef CLOCK_TREE_H
+#define CLOCK_TREE_H
+/**
+ * @copyright
+ * @file clock_tree.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Clock tree query function signatures
+ *        Frequencies of oscillators, PLL outputs, bus clocks and peripheral kernel clocks are derived from the RCC registers
+ *        They are cached until the clock configuration changes so that drivers can compute their dividers without walking the registers
+ */
+
+#include <stdint.h>
+
+/**
+ *  @defgroup ClockTreeGroup Clock tree macros, structure and functions
+ *  @brief Clock tree macros, structure and functions
+ *  @{
+ */
+
+/*!< Oscillator frequencies in Hz */
+#define CLOCK_TREE_HSI_FREQ 64000000UL
+#define CLOCK_TREE_CSI_FREQ 4000000UL
+#define CLOCK_TREE_HSI48_FREQ 48000000UL
+#define CLOCK_TREE_LSI_FREQ 32000UL
+#define CLOCK_TREE_LSE_FREQ 32768UL
+
+/**
+ * @brief Clocks
+ *        PLL outputs of the same PLL must be consecutive and in order P, Q and R. Kernel clocks must be the last ones
+ */
+typedef enum {
+	CLOCK_TREE_NONE,          /*!< No clock or external clock of unknown frequency. Its frequency is always 0 */
+	CLOCK_TREE_HSI,           /*!< HSI after its divider */
+	CLOCK_TREE_CSI,           /*!< CSI */
+	CLOCK_TREE_HSE,           /*!< HSE */
+	CLOCK_TREE_HSI48,         /*!< HSI48 */
+	CLOCK_TREE_LSI,           /*!< LSI */
+	CLOCK_TREE_LSE,           /*!< LSE */
+	CLOCK_TREE_PLL1P,         /*!< PLL1 P output */
+	CLOCK_TREE_PLL1Q,         /*!< PLL1 Q output */
+	CLOCK_TREE_PLL1R,         /*!< PLL1 R output */
+	CLOCK_TREE_PLL2P,         /*!< PLL2 P output */
+	CLOCK_TREE_PLL2Q,         /*!< PLL2 Q output */
+	CLOCK_TREE_PLL2R,         /*!< PLL2 R output */
+	CLOCK_TREE_PLL3P,         /*!< PLL3 P output */
+	CLOCK_TREE_PLL3Q,         /*!< PLL3 Q output */
+	CLOCK_TREE_PLL3R,         /*!< PLL3 R output */
+	CLOCK_TREE_PER,           /*!< Peripheral clock (per_ck) */
+	CLOCK_TREE_SYSCLK,        /*!< System clock */
+	CLOCK_TREE_CPU,           /*!< Cortex-M7 core clock */
+	CLOCK_TREE_HCLK,          /*!< AXI and AHB clock */
+	CLOCK_TREE_PCLK1,         /*!< APB1 clock */
+	CLOCK_TREE_PCLK2,         /*!< APB2 clock */
+	CLOCK_TREE_PCLK3,         /*!< APB3 clock */
+	CLOCK_TREE_PCLK4,         /*!< APB4 clock */
+	CLOCK_TREE_TIMER1,        /*!< Clock of the timers on APB1 */
+	CLOCK_TREE_TIMER2,        /*!< Clock of the timers on APB2 */
+	CLOCK_TREE_USART16,       /*!< USART1 and USART6 kernel clock */
+	CLOCK_TREE_USART234578,   /*!< USART2, USART3, UART4, UART5, UART7 and UART8 kernel clock */
+	CLOCK_TREE_LPUART1,       /*!< LPUART1 kernel clock */
+	CLOCK_TREE_I2C123,        /*!< I2C1, I2C2 and I2C3 kernel clock */
+	CLOCK_TREE_I2C4,          /*!< I2C4 kernel clock */
+	CLOCK_TREE_SPI123,        /*!< SPI1, SPI2 and SPI3 kernel clock */
+	CLOCK_TREE_SPI45,         /*!< SPI4 and SPI5 kernel clock */
+	CLOCK_TREE_SPI6,          /*!< SPI6 kernel clock */
+	CLOCK_TREE_QSPI,          /*!< QUADSPI kernel clock */
+	CLOCK_TREE_FMC,           /*!< FMC kernel clock */
+	CLOCK_TREE_SDMMC,         /*!< SDMMC kernel clock */
+	CLOCK_TREE_FDCAN,         /*!< FDCAN kernel clock */
+	CLOCK_TREE_RNG,           /*!< RNG kernel clock */
+	CLOCK_TREE_USB,           /*!< USB kernel clock */
+	CLOCK_TREE_ADC,           /*!< ADC kernel clock */
+	CLOCK_TREE_LPTIM1,        /*!< LPTIM1 kernel clock */
+	CLOCK_TREE_LPTIM2,        /*!< LPTIM2 kernel clock */
+	CLOCK_TREE_LPTIM345,      /*!< LPTIM3, LPTIM4 and LPTIM5 kernel clock */
+	CLOCK_TREE_CLOCK_NUMBER   /*!< Number of clocks */
+} clock_tree_clock;
+
+/*!< First kernel clock */
+#define CLOCK_TREE_KERNEL_FIRST CLOCK_TREE_USART16
+
+/**
+ * @brief Function: clock_tree_init
+ *
+ * Register to DVFS notifications in order to invalidate the cache every time the clock profile changes
+ */
+void clock_tree_init(void);
+
+/**
+ * @brief Function: clock_tree_get_freq
+ *
+ * \param clock: clock to query
+ * \return frequency of the clock in Hz or 0 if the clock is stopped or does not exist
+ *
+ * All frequencies are computed from the RCC registers on the first call after the cache has been invalidated
+ */
+uint32_t clock_tree_get_freq(clock_tree_clock clock);
+
+/**
+ * @brief Function: clock_tree_invalidate
+ *
+ * Invalidate the cache. It must be called after changing a PLL, a prescaler or a kernel clock selection outside of the DVFS functions
+ */
+void clock_tree_invalidate(void);
+
+/** @} */ // End of ClockTreeGroup group
+
+#endif // CLOCK_TREE_H
@@ -0,0 +1,157 @@
+#ifndef DVFS_H
+#define DVFS_H
+/**
+ * @copyright
+ * @file dvfs.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Dynamic voltage and frequency scaling (DVFS) function signatures
+ *        The system switches between named clock profiles. Each profile sets the system clock source, the core and AXI prescalers and the lowest voltage scaling they allow
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ *  @defgroup DvfsGroup DVFS macros, structure and functions
+ *  @brief DVFS macros, structure and functions
+ *  @{
+ */
+
+/*!< Maximum number of functions notified of clock changes */
+#define DVFS_NOTIFIERS_MAX 8U
+
+/**
+ * @brief Voltage scaling
+ *        Lower values mean higher core voltage
+ */
+typedef enum {
+	DVFS_VOS0,   /*!< VOS1 with overdrive. Only available when the core is supplied by the LDO regulator */
+	DVFS_VOS1,   /*!< VOS1 */
+	DVFS_VOS2,   /*!< VOS2 */
+	DVFS_VOS3    /*!< VOS3 (reset value) */
+} dvfs_voltage_scale;
+
+/**
+ * @brief Clock profiles
+ */
+typedef enum {
+	DVFS_PROFILE_IDLE,      /*!< HSI at 64 MHz in VOS3 with PLL1 off */
+	DVFS_PROFILE_ACQUIRE,   /*!< PLL1 with the core prescaler dividing by 2 */
+	DVFS_PROFILE_BURST,     /*!< PLL1 at full speed. It is the profile set up by the startup code */
+	DVFS_PROFILE_NUMBER     /*!< Number of profiles */
+} dvfs_profile;
+
+/**
+ * @brief Clock profile configuration
+ */
+typedef struct {
+	const char * name;          /*!< Name of the profile */
+	uint32_t sysclk;            /*!< System clock source */
+	uint32_t core_prescaler;    /*!< D1 domain core prescaler */
+	uint32_t ahb_prescaler;     /*!< AXI and AHB prescaler */
+	dvfs_voltage_scale scale;   /*!< Lowest voltage scaling allowed by the clocks */
+	bool pll1_on;               /*!< PLL1 is kept running */
+	uint32_t core_freq;         /*!< Core clock frequency in Hz */
+	uint32_t axi_freq;          /*!< AXI and AHB clock frequency in Hz */
+} dvfs_profile_config;
+
+/**
+ * @brief Notification event
+ */
+typedef enum {
+	DVFS_EVENT_PRE_CHANGE,    /*!< Clocks are about to change */
+	DVFS_EVENT_POST_CHANGE    /*!< Clocks have changed */
+} dvfs_event;
+
+/**
+ * @brief Function notified of clock changes
+ *        Drivers whose kernel clock derives from the bus clocks or from PLL1 stop their transfers before the change and reprogram their dividers after it
+ */
+typedef void (*dvfs_notifier)(dvfs_event event, const dvfs_profile_config * from, const dvfs_profile_config * to);
+
+/**
+ * @brief Flash wait states
+ *        Flash read latency and programming delay required up to a given AXI clock frequency
+ */
+typedef struct {
+	uint32_t max_freq;     /*!< Maximum AXI clock frequency in Hz */
+	uint32_t latency;      /*!< Read latency */
+	uint32_t wrhighfreq;   /*!< Programming delay */
+} dvfs_flash_wait_state;
+
+/**
+ * @brief Function: dvfs_flash_wait_states_get
+ *
+ * \param scale: voltage scaling
+ * \param axi_freq: AXI clock frequency in Hz
+ * \return flash wait states required by the AXI clock frequency in the voltage scaling or the highest entry of the table if the frequency is out of range
+ */
+const dvfs_flash_wait_state * dvfs_flash_wait_states_get(dvfs_voltage_scale scale, uint32_t axi_freq);
+
+/**
+ * @brief Function: dvfs_flash_wait_states_set
+ *
+ * \param scale: voltage scaling
+ * \param axi_freq: AXI clock frequency in Hz
+ *
+ * Program flash latency and programming delay for the AXI clock frequency in the voltage scaling
+ */
+void dvfs_flash_wait_states_set(dvfs_voltage_scale scale, uint32_t axi_freq);
+
+/**
+ * @brief Function: dvfs_init
+ *
+ * Take over the clocks configured by the startup code. The system runs in profile DVFS_PROFILE_BURST
+ */
+void dvfs_init(void);
+
+/**
+ * @brief Function: dvfs_set_profile
+ *
+ * \param profile: profile to switch to
+ * \return true if the profile has been set, false if the profile does not exist
+ *
+ * Voltage is raised and flash latency increased before the clocks speed up. Both are lowered after the clocks slow down
+ * Notifiers are called before and after the change
+ */
+bool dvfs_set_profile(dvfs_profile profile);
+
+/**
+ * @brief Function: dvfs_get_profile
+ *
+ * \return current profile
+ */
+dvfs_profile dvfs_get_profile(void);
+
+/**
+ * @brief Function: dvfs_get_profile_config
+ *
+ * \param profile: profile
+ * \return configuration of the profile or NULL if the profile does not exist
+ */
+const dvfs_profile_config * dvfs_get_profile_config(dvfs_profile profile);
+
+/**
+ * @brief Function: dvfs_register_notifier
+ *
+ * \param notifier: function to notify of clock changes
+ * \return true if the function has been registered, false if DVFS_NOTIFIERS_MAX functions are already registered
+ */
+bool dvfs_register_notifier(dvfs_notifier notifier);
+
+/**
+ * @brief Function: dvfs_get_transition_ns
+ *
+ * \param from: profile the system switched from
+ * \param to: profile the system switched to
+ * \return duration in nanoseconds of the last transition between the two profiles or 0 if it has never happened or either profile does not exist
+ *
+ * Duration is measured with the cycle counter and converted with the core clock frequency before and after the switch of the clocks
+ * Cycles elapsed while the system clock switches are converted with the lower of the two frequencies
+ */
+uint32_t dvfs_get_transition_ns(dvfs_profile from, dvfs_profile to);
+
+/** @} */ // End of DvfsGroup group
+
+#endif // DVFS_H
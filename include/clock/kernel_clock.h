@@ -0,0 +1,62 @@
+#ifndef KERNEL_CLOCK_H
+#define KERNEL_CLOCK_H
+/**
+ * @copyright
+ * @file kernel_clock.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Kernel clock routing function signatures
+ *        Peripherals are clocked by dedicated PLL2 and PLL3 outputs so that their timings do not depend on the bus clocks changed by DVFS
+ */
+
+#include <stdbool.h>
+
+#include "clock/clock_tree.h"
+
+/**
+ *  @defgroup KernelClockGroup Kernel clock macros, structure and functions
+ *  @brief Kernel clock macros, structure and functions
+ *  @{
+ */
+
+/*!< Maximum number of sources of a kernel clock. It is the number of values of the widest selection field */
+#define KERNEL_CLOCK_SOURCES_MAX 8U
+
+/**
+ * @brief Kernel clock route
+ */
+typedef struct {
+	clock_tree_clock kernel;   /*!< Kernel clock */
+	clock_tree_clock source;   /*!< Clock feeding the kernel clock */
+} kernel_clock_route;
+
+/**
+ * @brief Function: kernel_clock_init
+ *
+ * Route kernel clocks to the sources of the default routing table
+ * Peripherals must be disabled as their kernel clock changes
+ */
+void kernel_clock_init(void);
+
+/**
+ * @brief Function: kernel_clock_set_source
+ *
+ * \param kernel: kernel clock
+ * \param source: clock feeding the kernel clock
+ * \return true if the kernel clock has been routed, false if the clock is not a kernel clock or the source cannot feed it
+ *
+ * The clock tree cache is invalidated after the change
+ */
+bool kernel_clock_set_source(clock_tree_clock kernel, clock_tree_clock source);
+
+/**
+ * @brief Function: kernel_clock_get_source
+ *
+ * \param kernel: kernel clock
+ * \return clock feeding the kernel clock or CLOCK_TREE_NONE if the clock is not a kernel clock, it is disabled or the selection is reserved
+ */
+clock_tree_clock kernel_clock_get_source(clock_tree_clock kernel);
+
+/** @} */ // End of KernelClockGroup group
+
+#endif // KERNEL_CLOCK_H
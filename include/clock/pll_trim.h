@@ -0,0 +1,58 @@
+#ifndef PLL_TRIM_H
+#define PLL_TRIM_H
+/**
+ * @copyright
+ * @file pll_trim.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief PLL fractional trimming function signatures
+ *        The fractional part of the multiplication factor is updated while the PLL runs so that an output hits an exact frequency without relocking
+ *        The integer part cannot change hence the VCO can move by one reference clock step at most. PLLs must be in fractional mode (make PLL_FRACTIONAL)
+ *        PLL1 drives the system clock hence it is changed by DVFS profiles only. Flash latency and the profile frequencies would not follow a trim
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "clock/clock_tree.h"
+
+/**
+ *  @defgroup PllTrimGroup PLL trim macros, structure and functions
+ *  @brief PLL trim macros, structure and functions
+ *  @{
+ */
+
+/*!< First PLL that can be trimmed */
+#define PLL_TRIM_PLL_FIRST 2U
+
+/*!< Number of PLLs */
+#define PLL_TRIM_PLL_NUMBER 3U
+
+/*!< Highest value of the fractional part of the multiplication factor */
+#define PLL_TRIM_FRACN_MAX 8191UL
+
+/**
+ * @brief Function: pll_trim_set_fracn
+ *
+ * \param pll: PLL number from PLL_TRIM_PLL_FIRST to PLL_TRIM_PLL_NUMBER
+ * \param fracn: fractional part of the multiplication factor in steps of 1/8192
+ * \return true if the value has been latched, false if the arguments are out of range or the PLL is not locked in fractional mode
+ *
+ * The new value is latched by the sigma-delta modulator when fractional mode is enabled again. The PLL output does not glitch
+ */
+bool pll_trim_set_fracn(uint32_t pll, uint32_t fracn);
+
+/**
+ * @brief Function: pll_trim_set_freq
+ *
+ * \param output: PLL output, from CLOCK_TREE_PLL2P to CLOCK_TREE_PLL3R
+ * \param freq: target frequency in Hz
+ * \return frequency reached by the output in Hz or 0 if the output is stopped, the PLL is not locked in fractional mode or the target cannot be reached without changing the integer part
+ *
+ * Other outputs of the same PLL move by the same ratio. The clock tree cache is invalidated
+ */
+uint32_t pll_trim_set_freq(clock_tree_clock output, uint32_t freq);
+
+/** @} */ // End of PllTrimGroup group
+
+#endif // PLL_TRIM_H
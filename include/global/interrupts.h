@@ -0,0 +1,190 @@
+#ifndef INTERRUPTS_H
+#define INTERRUPTS_H
+/**
+ * @copyright
+ * @file interrupts.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Interrupt numbers
+ *        Numbers follow the order of the vector table in boot.s. System exceptions have negative numbers
+ *        Names are IRQ_ followed by the prefix of the handler name in boot.s (e.g. IRQ_DMA1_Stream0 for DMA1_Stream0_irq_handler)
+ */
+
+/**
+ *  @defgroup InterruptsGroup Interrupt macros and enumerations
+ *  @brief Interrupt macros and enumerations
+ *  @{
+ */
+
+/*!< Number of entries at the beginning of the vector table that are not external interrupts (initial stack pointer and system exceptions) */
+#define IRQ_SYSTEM_EXCEPTIONS 16U
+
+/**
+ * @brief Interrupt numbers
+ */
+typedef enum {
+	// System exceptions
+	IRQ_NMI                = -14,  /*!< Non maskable interrupt */
+	IRQ_HardFault          = -13,  /*!< All classes of fault */
+	IRQ_MemManage          = -12,  /*!< Memory management */
+	IRQ_BusFault           = -11,  /*!< Prefetch fault or memory access fault */
+	IRQ_UsageFault         = -10,  /*!< Undefined instruction or illegal state */
+	IRQ_SVCall             = -5,   /*!< System service call via SWI instruction */
+	IRQ_DebugMonitor       = -4,   /*!< Debug monitor */
+	IRQ_PendSV             = -2,   /*!< Pendable request for system service */
+	IRQ_SysTick            = -1,   /*!< System tick timer */
+
+	// External interrupts
+	IRQ_WWDG               = 0,    /*!< Window watchdog Interrupt (wwdg1, wwdg2) */
+	IRQ_PVD                = 1,    /*!< Programmable Voltage Detector (PVD) through External Interrupts (EXTI) Line detection interrupt */
+	IRQ_TAMP_STAMP         = 2,    /*!< Real-Time clock (RTC) Tamper and TimeStamps through the External Interrupts (EXTI) line */
+	IRQ_RTC_WKUP           = 3,    /*!< Real-Time clock (RTC) Wakeup through the External Interrupts (EXTI) line */
+	IRQ_FLASH              = 4,    /*!< Flash memory global interrupt */
+	IRQ_RCC                = 5,    /*!< Reset and Clock Control (RCC) global interrupt */
+	IRQ_EXTI0              = 6,    /*!< External Interrupts (EXTI) Line0 global interrupt */
+	IRQ_EXTI1              = 7,    /*!< External Interrupts (EXTI) Line1 global interrupt */
+	IRQ_EXTI2              = 8,    /*!< External Interrupts (EXTI) Line2 global interrupt */
+	IRQ_EXTI3              = 9,    /*!< External Interrupts (EXTI) Line3 global interrupt */
+	IRQ_EXTI4              = 10,   /*!< External Interrupts (EXTI) Line4 global interrupt */
+	IRQ_DMA1_Stream0       = 11,   /*!< Direct memory Access 1 (DMA1) Stream 0 global interrupt global interrupt */
+	IRQ_DMA1_Stream1       = 12,   /*!< Direct memory Access 1 (DMA1) Stream 1 global interrupt global interrupt */
+	IRQ_DMA1_Stream2       = 13,   /*!< Direct memory Access 1 (DMA1) Stream 2 global interrupt global interrupt */
+	IRQ_DMA1_Stream3       = 14,   /*!< Direct memory Access 1 (DMA1) Stream 3 global interrupt global interrupt */
+	IRQ_DMA1_Stream4       = 15,   /*!< Direct memory Access 1 (DMA1) Stream 4 global interrupt global interrupt */
+	IRQ_DMA1_Stream5       = 16,   /*!< Direct memory Access 1 (DMA1) Stream 5 global interrupt global interrupt */
+	IRQ_DMA1_Stream6       = 17,   /*!< Direct memory Access 1 (DMA1) Stream 6 global interrupt global interrupt */
+	IRQ_ADC1_ADC2          = 18,   /*!< Analog digital converter 1 (ADC1) and Analog digital converter 2 (ADC2) global interrupt */
+	IRQ_FDCAN1_IT0         = 19,   /*!< Flexible datarate controller area network 1 (FDCAN1) interrupt line 0 */
+	IRQ_FDCAN2_IT0         = 20,   /*!< Flexible datarate controller area network 2 (FDCAN2) interrupt line 0 */
+	IRQ_FDCAN1_IT1         = 21,   /*!< Flexible datarate controller area network 1 (FDCAN1) interrupt line 1 */
+	IRQ_FDCAN2_IT1         = 22,   /*!< Flexible datarate controller area network 2 (FDCAN2) interrupt line 1 */
+	IRQ_EXTI9_5            = 23,   /*!< External Line[9:5] interrupts */
+	IRQ_TIM1_BRK           = 24,   /*!< Advanced-control timer 1 (TIM1) Break interrupt */
+	IRQ_TIM1_UP            = 25,   /*!< Advanced-control timer 1 (TIM1) Update interrupt */
+	IRQ_TIM1_TRG_COM       = 26,   /*!< Advanced-control timer 1 (TIM1) Trigger and Commutation interrupt */
+	IRQ_TIM1_CC            = 27,   /*!< Advanced-control timer 1 (TIM1) Capture Compare interrupt */
+	IRQ_TIM2               = 28,   /*!< General-purpose timer 2 (TIM2) global interrupt */
+	IRQ_TIM3               = 29,   /*!< General-purpose timer 3 (TIM3) global interrupt */
+	IRQ_TIM4               = 30,   /*!< General-purpose timer 4 (TIM4) global interrupt */
+	IRQ_I2C1_EV            = 31,   /*!< Inter integrated circuit 1 (I2C1) Event interrupt */
+	IRQ_I2C1_ER            = 32,   /*!< Inter integrated circuit 1 (I2C1) Error interrupt */
+	IRQ_I2C2_EV            = 33,   /*!< Inter integrated circuit 2 (I2C2) Event interrupt */
+	IRQ_I2C2_ER            = 34,   /*!< Inter integrated circuit 2 (I2C2) Error interrupt */
+	IRQ_SPI1               = 35,   /*!< Serial peripheral interface 1 (SPI1) global interrupt */
+	IRQ_SPI2               = 36,   /*!< Serial peripheral interface 2 (SPI2) global interrupt */
+	IRQ_USART1             = 37,   /*!< Universal synchronous/asynchronous receiver transmitter 1 (USART1) global interrupt */
+	IRQ_USART2             = 38,   /*!< Universal synchronous/asynchronous receiver transmitter 2 (USART2) global interrupt */
+	IRQ_USART3             = 39,   /*!< Universal synchronous/asynchronous receiver transmitter 3 (USART3) global interrupt */
+	IRQ_EXTI15_10          = 40,   /*!< External Line[15:10] interrupts */
+	IRQ_RTC_Alarm          = 41,   /*!< Real Time Clock (RTC) Alarm (A and B) through External Interrupts (EXTI) Line */
+	IRQ_TIM8_BRK_TIM12     = 43,   /*!< Advanced-control timer 8 (TIM8) Break and General-purpose timer 12 (TIM12) global interrupt */
+	IRQ_TIM8_UP_TIM13      = 44,   /*!< Advanced-control timer 8 (TIM8) Update and General-purpose timer 13 (TIM13) global interrupt */
+	IRQ_TIM8_TRG_COM_TIM14 = 45,   /*!< Advanced-control timer 8 (TIM8) Trigger and Commutation and General-purpose timer 14 (TIM14) global interrupt */
+	IRQ_TIM8_CC            = 46,   /*!< Advanced-control timer 8 (TIM8) Capture Compare interrupt */
+	IRQ_DMA1_Stream7       = 47,   /*!< Direct memory Access 1 (DMA1) Stream 7 global interrupt */
+	IRQ_FMC                = 48,   /*!< Flexible memory controller (FMC) global interrupt */
+	IRQ_SDMMC1             = 49,   /*!< Secure digital and multimedia card  (SDMMC1) global interrupt */
+	IRQ_TIM5               = 50,   /*!< General-purpose timer 5 (TIM5) global interrupt */
+	IRQ_SPI3               = 51,   /*!< Serial peripheral interface 3 (SPI3) global interrupt */
+	IRQ_UART4              = 52,   /*!< Universal asynchronous receiver transmitter 4 (UART4) global interrupt */
+	IRQ_UART5              = 53,   /*!< Universal asynchronous receiver transmitter 5 (UART5) global interrupt */
+	IRQ_TIM6_DAC           = 54,   /*!< Basic timer 6 (TIM6) global interrupt and DAC underrun errors interrupt */
+	IRQ_TIM7               = 55,   /*!< Basic timer 7 (TIM7) */
+	IRQ_DMA2_Stream0       = 56,   /*!< Direct memory Access 2 (DMA2) Stream 0 */
+	IRQ_DMA2_Stream1       = 57,   /*!< Direct memory Access 2 (DMA2) Stream 1 */
+	IRQ_DMA2_Stream2       = 58,   /*!< Direct memory Access 2 (DMA2) Stream 2 */
+	IRQ_DMA2_Stream3       = 59,   /*!< Direct memory Access 2 (DMA2) Stream 3 */
+	IRQ_DMA2_Stream4       = 60,   /*!< Direct memory Access 2 (DMA2) Stream 4 */
+	IRQ_ETH                = 61,   /*!< Ethernet */
+	IRQ_ETH_WKUP           = 62,   /*!< Ethernet Wakeup through External Interrupts (EXTI) line */
+	IRQ_FDCAN_CAL          = 63,   /*!< Flexible datarate controller area network (FDCAN) calibration unit interrupt */
+	IRQ_CM7_SEV            = 64,   /*!< Cortex-M7 Send event interrupt for Cortex-M4 */
+	IRQ_CM4_SEV            = 65,   /*!< Cortex-M4 Send event interrupt for Cortex-M7 */
+	IRQ_DMA2_Stream5       = 68,   /*!< Direct memory Access 2 (DMA2) Stream 5 */
+	IRQ_DMA2_Stream6       = 69,   /*!< Direct memory Access 2 (DMA2) Stream 6 */
+	IRQ_DMA2_Stream7       = 70,   /*!< Direct memory Access 2 (DMA2) Stream 7 */
+	IRQ_USART6             = 71,   /*!< Universal synchronous/asynchronous receiver transmitter 6 (USART6) */
+	IRQ_I2C3_EV            = 72,   /*!< Inter integrated circuit 3 (I2C3) event */
+	IRQ_I2C3_ER            = 73,   /*!< Inter integrated circuit 3 (I2C3) error */
+	IRQ_USB_OTG_HS_EP1_OUT = 74,   /*!< Universal serial bus on-the-go high speed End Point 1 Out */
+	IRQ_USB_OTG_HS_EP1_IN  = 75,   /*!< Universal serial bus on-the-go high speed End Point 1 In */
+	IRQ_USB_OTG_HS_WKUP    = 76,   /*!< Universal serial bus on-the-go high speed Wakeup through External Interrupts (EXTI) */
+	IRQ_USB_OTG_HS         = 77,   /*!< Universal serial bus on-the-go high speed */
+	IRQ_DCMI               = 78,   /*!< Digital camera interface */
+	IRQ_CRYP               = 79,   /*!< Cryptographic processor */
+	IRQ_RNG                = 80,   /*!< Random number generation */
+	IRQ_FPU                = 81,   /*!< Floating point unit (FPU) */
+	IRQ_UART7              = 82,   /*!< Universal asynchronous receiver transmitter 7 (UART7) */
+	IRQ_UART8              = 83,   /*!< Universal asynchronous receiver transmitter 8 (UART8) */
+	IRQ_SPI4               = 84,   /*!< Serial peripheral interface 4 (SPI4) */
+	IRQ_SPI5               = 85,   /*!< Serial peripheral interface 5 (SPI5) */
+	IRQ_SPI6               = 86,   /*!< Serial peripheral interface 6 (SPI6) */
+	IRQ_SAI1               = 87,   /*!< Serial Audio Interface 1 (SAI1) */
+	IRQ_LTDC               = 88,   /*!< LCD-TFT display controller */
+	IRQ_LTDC_ER            = 89,   /*!< LCD-TFT display controller error */
+	IRQ_DMA2D              = 90,   /*!< Chrom-Art Acceleration controller (DMA2D) */
+	IRQ_SAI2               = 91,   /*!< Serial Audio Interface 2 (SAI2) */
+	IRQ_QUADSPI            = 92,   /*!< Quad serial peripheral interface (QUADSPI) */
+	IRQ_LPTIM1             = 93,   /*!< Low power timer 1 (LPTIM1) */
+	IRQ_CEC                = 94,   /*!< High definition multimedia interface (HDMI-CEC) */
+	IRQ_I2C4_EV            = 95,   /*!< Inter integrated circuit 4 (I2C4) Event */
+	IRQ_I2C4_ER            = 96,   /*!< Inter integrated circuit 4 (I2C4) Error */
+	IRQ_SPDIF_RX           = 97,   /*!< Sony/Philips digital interface (S/PDIF) receiver global interrupt */
+	IRQ_USB_OTG_FS_EP1_OUT = 98,   /*!< Universal serial bus on-the-go full speed End Point 1 Out */
+	IRQ_USB_OTG_FS_EP1_IN  = 99,   /*!< Universal serial bus on-the-go full speed End Point 1 In */
+	IRQ_USB_OTG_FS_WKUP    = 100,  /*!< Universal serial bus on-the-go full speed Wakeup through External Interrupts (EXTI) */
+	IRQ_USB_OTG_FS         = 101,  /*!< Universal serial bus on-the-go full speed */
+	IRQ_DMAMUX1_OVR        = 102,  /*!< DMAMUX1 Overrun interrupt */
+	IRQ_HRTIM1_Master      = 103,  /*!< High resolutio timer (HRTIM) Master Timer global Interrupt */
+	IRQ_HRTIM1_TIMA        = 104,  /*!< High resolution timer (HRTIM) Timer A global Interrupt */
+	IRQ_HRTIM1_TIMB        = 105,  /*!< High resolution timer (HRTIM) Timer B global Interrupt */
+	IRQ_HRTIM1_TIMC        = 106,  /*!< High resolution timer (HRTIM) Timer C global Interrupt */
+	IRQ_HRTIM1_TIMD        = 107,  /*!< High resolution timer (HRTIM) Timer D global Interrupt */
+	IRQ_HRTIM1_TIME        = 108,  /*!< High resolution timer (HRTIM) Timer E global Interrupt */
+	IRQ_HRTIM1_FLT         = 109,  /*!< High resolution timer (HRTIM) Fault global Interrupt */
+	IRQ_DFSDM1_FLT0        = 110,  /*!< Digital filter for sigma delta modulators (DFSDM) Filter0 Interrupt */
+	IRQ_DFSDM1_FLT1        = 111,  /*!< Digital filter for sigma delta modulators (DFSDM) Filter1 Interrupt */
+	IRQ_DFSDM1_FLT2        = 112,  /*!< Digital filter for sigma delta modulators (DFSDM) Filter2 Interrupt */
+	IRQ_DFSDM1_FLT3        = 113,  /*!< Digital filter for sigma delta modulators (DFSDM) Filter3 Interrupt */
+	IRQ_SAI3               = 114,  /*!< Serial Audio Interface 3 (SAI3) global Interrupt */
+	IRQ_SWPMI1             = 115,  /*!< Serial Wire Interface 1 global interrupt */
+	IRQ_TIM15              = 116,  /*!< General-purpose timer 15 (TIM15) global Interrupt */
+	IRQ_TIM16              = 117,  /*!< General-purpose timer 16 (TIM16) global Interrupt */
+	IRQ_TIM17              = 118,  /*!< General-purpose timer 17 (TIM17) global Interrupt */
+	IRQ_MDIOS_WKUP         = 119,  /*!< Management data input/output (MDIOS) Wakeup  Interrupt */
+	IRQ_MDIOS              = 120,  /*!< Management data input/output (MDIOS) global Interrupt */
+	IRQ_JPEG               = 121,  /*!< JPEG global Interrupt */
+	IRQ_MDMA               = 122,  /*!< Multi-Direct memory Access (MDMA) global Interrupt */
+	IRQ_DSI_DSI_wakeup     = 123,  /*!< Display Serial Interface (DSI) Host global and wakeup Interrupt */
+	IRQ_SDMMC2             = 124,  /*!< Secure digital and multimedia card  (SDMMC2) global Interrupt */
+	IRQ_HSEM1              = 125,  /*!< Hardware semaphores 1 (HSEM1) global Interrupt */
+	IRQ_HSEM2              = 126,  /*!< Hardware semaphores 1 (HSEM1) global Interrupt */
+	IRQ_ADC3               = 127,  /*!< Analog digital converter 3 (ADC3) global Interrupt */
+	IRQ_DMAMUX2_OVR        = 128,  /*!< Direct memory access request multiplexer (DMAMUX) Overrun interrupt */
+	IRQ_BDMA_Channel0      = 129,  /*!< Basic Direct memory Access (BDMA) Channel 0 global Interrupt */
+	IRQ_BDMA_Channel1      = 130,  /*!< Basic Direct memory Access (BDMA) Channel 1 global Interrupt */
+	IRQ_BDMA_Channel2      = 131,  /*!< Basic Direct memory Access (BDMA) Channel 2 global Interrupt */
+	IRQ_BDMA_Channel3      = 132,  /*!< Basic Direct memory Access (BDMA) Channel 3 global Interrupt */
+	IRQ_BDMA_Channel4      = 133,  /*!< Basic Direct memory Access (BDMA) Channel 4 global Interrupt */
+	IRQ_BDMA_Channel5      = 134,  /*!< Basic Direct memory Access (BDMA) Channel 5 global Interrupt */
+	IRQ_BDMA_Channel6      = 135,  /*!< Basic Direct memory Access (BDMA) Channel 6 global Interrupt */
+	IRQ_BDMA_Channel7      = 136,  /*!< Basic Direct memory Access (BDMA) Channel 7 global Interrupt */
+	IRQ_COMP1              = 137,  /*!< Comparator (COMP1) global Interrupt */
+	IRQ_LPTIM2             = 138,  /*!< Low power timer 2 (LPTIM2) global interrupt */
+	IRQ_LPTIM3             = 139,  /*!< Low power timer 3 (LPTIM3) global interrupt */
+	IRQ_LPTIM4             = 140,  /*!< Low power timer 4 (LPTIM4) global interrupt */
+	IRQ_LPTIM5             = 141,  /*!< Low power timer 5 (LPTIM5) global interrupt */
+	IRQ_LPUART1            = 142,  /*!< Low-power universal asynchronous receiver transmitter 1 (LPUART1) interrupt */
+	IRQ_WWDG_RST           = 143,  /*!< Window Watchdog reset interrupt (exti_d2_wwdg_it, exti_d1_wwdg_it) */
+	IRQ_CRS                = 144,  /*!< Clock Recovery Global Interrupt */
+	IRQ_ECC                = 145,  /*!< ECC diagnostic Global Interrupt */
+	IRQ_SAI4               = 146,  /*!< Serial Audio Interface 4 (SAI4) global interrupt */
+	IRQ_CPU_hold           = 148,  /*!< CPU hold Interrupt */
+	IRQ_WAKEUP_PIN         = 149,  /*!< Interrupt for all 6 wake-up pins */
+
+	IRQ_NUMBER             = 150   /*!< Number of external interrupts */
+} irq_number;
+
+/** @} */ // End of InterruptsGroup group
+
+#endif // INTERRUPTS_H
@@ -0,0 +1,89 @@
+#ifndef D3_ACQUISITION_H
+#define D3_ACQUISITION_H
+/**
+ * @copyright
+ * @file d3_acquisition.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief D3 domain autonomous acquisition function signatures
+ *        Channel 0 of the BDMA moves samples from a D3 peripheral into SRAM4 while the cores sleep. Domain D3 is kept running in autonomous mode and CPU1 is woken up once per batch
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ *  @defgroup D3AcquisitionGroup D3 acquisition macros, structure and functions
+ *  @brief D3 acquisition macros, structure and functions
+ *  @{
+ */
+
+/*!< Size of the sample buffer in SRAM4 in bytes. It holds two batches */
+#define D3_ACQUISITION_BUFFER_SIZE 4096U
+
+/**
+ * @brief Size of a sample
+ *        Values are the BDMA data size encoding
+ */
+typedef enum {
+	D3_ACQUISITION_SIZE_8BITS,    /*!< 1 byte */
+	D3_ACQUISITION_SIZE_16BITS,   /*!< 2 bytes */
+	D3_ACQUISITION_SIZE_32BITS    /*!< 4 bytes */
+} d3_acquisition_sample_size;
+
+/**
+ * @brief Function called from the BDMA interrupt when a batch is complete
+ *        The batch is not overwritten until the other half of the buffer has been filled
+ */
+typedef void (*d3_acquisition_callback)(const void * batch, uint32_t samples);
+
+/**
+ * @brief Acquisition configuration
+ */
+typedef struct {
+	uint32_t request;                          /*!< DMAMUX2 request input of the peripheral */
+	uint32_t peripheral_address;               /*!< Address of the data register of the peripheral */
+	d3_acquisition_sample_size sample_size;    /*!< Size of a sample */
+	uint32_t batch_samples;                    /*!< Number of samples after which CPU1 is woken up */
+	uint32_t autonomous_mask;                  /*!< Autonomous mode enable bits of the peripheral in RCC D3AMR */
+	d3_acquisition_callback callback;          /*!< Function called when a batch is complete */
+} d3_acquisition_config;
+
+/**
+ * @brief Function: d3_acquisition_start
+ *
+ * \param config: acquisition configuration
+ * \return true if the acquisition started, false if two batches do not fit the buffer or an acquisition is already running
+ *
+ * The peripheral must be clocked in low power mode and set up to issue DMA requests by its driver
+ * Samples are written in circular mode to the two halves of the buffer. The BDMA interrupt wakes up CPU1 from Stop mode through EXTI
+ */
+bool d3_acquisition_start(const d3_acquisition_config * config);
+
+/**
+ * @brief Function: d3_acquisition_has_failed
+ *
+ * \return true if the BDMA channel has been disabled by a transfer error
+ *
+ * The interrupt handler only disables the channel. d3_acquisition_stop must then be called from thread context to release the clock gates before the acquisition is started again
+ */
+bool d3_acquisition_has_failed(void);
+
+/**
+ * @brief Function: d3_acquisition_stop
+ *
+ * Stop the BDMA channel and let domain D3 follow the power mode of the cores again
+ * It releases clock gates hence it must not be called from an interrupt handler
+ */
+void d3_acquisition_stop(void);
+
+/**
+ * @brief Function: d3_acquisition_get_batches
+ *
+ * \return number of batches completed since the acquisition started
+ */
+uint32_t d3_acquisition_get_batches(void);
+
+/** @} */ // End of D3AcquisitionGroup group
+
+#endif // D3_ACQUISITION_H
@@ -0,0 +1,74 @@
+#ifndef LOW_POWER_H
+#define LOW_POWER_H
+/**
+ * @copyright
+ * @file low_power.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Low power manager function signatures
+ *        The core enters Stop mode and is woken up by the RTC wakeup timer through EXTI. The clock profile is restored on exit
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "clock/dvfs.h"
+
+/**
+ *  @defgroup LowPowerGroup Low power macros, structure and functions
+ *  @brief Low power macros, structure and functions
+ *  @{
+ */
+
+/*!< LSI frequency in Hz. LSI clocks the RTC */
+#define LOW_POWER_LSI_FREQ 32000UL
+
+/*!< Frequency in Hz of the wakeup timer and of the sub second counter. Both are clocked by RTCCLK / 2 */
+#define LOW_POWER_TICK_FREQ (LOW_POWER_LSI_FREQ / 2UL)
+
+/*!< Longest time the core can stay in Stop mode in milliseconds */
+#define LOW_POWER_STOP_MAX_MS ((0x10000UL * 1000UL) / LOW_POWER_TICK_FREQ)
+
+/**
+ * @brief Statistics of the last wakeup from Stop mode
+ */
+typedef struct {
+	bool stop_entered;                  /*!< System entered Stop mode. It is false if the other core or domain D3 kept the system running and only domain D1 stopped */
+	bool timer_expired;                 /*!< Core was woken up by the wakeup timer rather than by another EXTI event */
+	uint32_t wake_to_instruction_ns;    /*!< Time from the expiry of the wakeup timer to the first instruction after WFI or 0 if the timer did not expire. It has the resolution of a tick of the sub second counter and includes the Stop entry */
+	uint32_t wake_to_full_speed_ns;     /*!< Time from the first instruction after WFI to the clock profile restored. It is measured with the cycle counter */
+	dvfs_profile profile;               /*!< Clock profile restored on exit */
+} low_power_wakeup;
+
+/**
+ * @brief Function: low_power_init
+ *
+ * \return true if the RTC wakeup timer is ready, false if the RTC is clocked by a source other than LSI
+ *
+ * Start LSI, clock the RTC from it and route the wakeup timer to CPU1 through EXTI
+ * Domains are kept in DStop mode while the core is in deepsleep as DStandby loses the content of the domain and powering down D1 resets the core
+ */
+bool low_power_init(void);
+
+/**
+ * @brief Function: low_power_stop
+ *
+ * \param ms: time to spend in Stop mode in milliseconds
+ * \return true if the core went to Stop mode, false if the low power manager is not initialized or the time is out of range
+ *
+ * Any interrupt unmasked in EXTI for CPU1 wakes the core up before the time elapses
+ * The system switches to profile DVFS_PROFILE_IDLE so that it enters Stop mode running from HSI which is also the clock it wakes up with
+ * On exit, oscillators and PLLs that were running are restarted and the previous profile is restored
+ */
+bool low_power_stop(uint32_t ms);
+
+/**
+ * @brief Function: low_power_get_wakeup
+ *
+ * \return statistics of the last wakeup from Stop mode
+ */
+const low_power_wakeup * low_power_get_wakeup(void);
+
+/** @} */ // End of LowPowerGroup group
+
+#endif // LOW_POWER_H
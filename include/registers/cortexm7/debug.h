@@ -9,6 +9,7 @@
 */
 
 #include <stdint.h>
+#include "global/cortexm7.h"
 
 /**
  *  @defgroup RegisterGroup Register global macros, structure and functions
@@ -314,8 +315,8 @@ typedef struct {
 #define DBG_RSTVECTORCATCH_ENABLE   (0x1UL)  /*!< Value 0x00000001 */
 
 #define DBG_OFFSET 0xDF0UL
-#define DBG_BASE OFFSET_ADDRESS(SCS_BASE, DBG_OFFSET)
-#define DBG REGISTER_PTR(scs_dbg_regs, DBG_BASE)
+#define DBG_BASE OFFSET_ADDRESS(CORTEXM7SCS_BASE, DBG_OFFSET)
+#define CORTEXM7DBG REGISTER_PTR(scs_dbg_regs, DBG_BASE)
 
 /** @} */ // End of CoreDebug group
 
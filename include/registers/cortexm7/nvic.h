@@ -9,6 +9,7 @@
 */
 
 #include <stdint.h>
+#include "global/cortexm7.h"
 
 /**
  *  @defgroup RegisterGroup Register global macros, structure and functions
@@ -518,8 +519,8 @@ typedef struct {
 #define NVIC_IPR_PRIORITY255  (0xFFUL)  /*!< Value 0x000000FF */
 
 #define NVIC_OFFSET 0x100UL
-#define NVIC_BASE OFFSET_ADDRESS(SCS_BASE, NVIC_OFFSET)
-#define NVIC REGISTER_PTR(nvic_regs, NVIC_BASE)
+#define NVIC_BASE OFFSET_ADDRESS(CORTEXM7SCS_BASE, NVIC_OFFSET)
+#define CORTEXM7NVIC REGISTER_PTR(nvic_regs, NVIC_BASE)
 
 /** @} */ // End of NVIC group
 
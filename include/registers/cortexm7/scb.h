@@ -9,6 +9,7 @@
 */
 
 #include <stdint.h>
+#include "global/cortexm7.h"
 
 /**
  *  @defgroup RegisterGroup Register global macros, structure and functions
@@ -1964,8 +1965,8 @@ typedef struct {
 #define SCB_COPROCESSORACCESSPRIVILEGES_FULLACCESS        (0x3UL)  /*!< Value 0x00000003 */
 
 #define SCB_OFFSET 0xD00UL
-#define SCB_BASE OFFSET_ADDRESS(SCS_BASE, SCB_OFFSET)
-#define SCB REGISTER_PTR(scs_scb_regs, SCB_BASE)
+#define SCB_BASE OFFSET_ADDRESS(CORTEXM7SCS_BASE, SCB_OFFSET)
+#define CORTEXM7SCB REGISTER_PTR(scs_scb_regs, SCB_BASE)
 
 /** @} */ // End of SCB group
 
@@ -70,22 +70,22 @@
 #define SYSMEM_PRESENT     (0x1UL)  /*!< Value 0x00000001 */
 
 // Values of square root of the number of 4K blocks register
-#define 4KCOUNT_1      (0x0UL)  /*!< Value 0x00000000 */
-#define 4KCOUNT_2      (0x1UL)  /*!< Value 0x00000001 */
-#define 4KCOUNT_4      (0x2UL)  /*!< Value 0x00000002 */
-#define 4KCOUNT_8      (0x3UL)  /*!< Value 0x00000003 */
-#define 4KCOUNT_16     (0x4UL)  /*!< Value 0x00000004 */
-#define 4KCOUNT_32     (0x5UL)  /*!< Value 0x00000005 */
-#define 4KCOUNT_64     (0x6UL)  /*!< Value 0x00000006 */
-#define 4KCOUNT_128    (0x7UL)  /*!< Value 0x00000007 */
-#define 4KCOUNT_256    (0x8UL)  /*!< Value 0x00000008 */
-#define 4KCOUNT_512    (0x9UL)  /*!< Value 0x00000009 */
-#define 4KCOUNT_1024   (0xAUL)  /*!< Value 0x0000000A */
-#define 4KCOUNT_2048   (0xBUL)  /*!< Value 0x0000000B */
-#define 4KCOUNT_4096   (0xCUL)  /*!< Value 0x0000000C */
-#define 4KCOUNT_8192   (0xDUL)  /*!< Value 0x0000000D */
-#define 4KCOUNT_16384  (0xEUL)  /*!< Value 0x0000000E */
-#define 4KCOUNT_32728  (0xFUL)  /*!< Value 0x0000000F */
+#define BLOCK4KCOUNT_1      (0x0UL)  /*!< Value 0x00000000 */
+#define BLOCK4KCOUNT_2      (0x1UL)  /*!< Value 0x00000001 */
+#define BLOCK4KCOUNT_4      (0x2UL)  /*!< Value 0x00000002 */
+#define BLOCK4KCOUNT_8      (0x3UL)  /*!< Value 0x00000003 */
+#define BLOCK4KCOUNT_16     (0x4UL)  /*!< Value 0x00000004 */
+#define BLOCK4KCOUNT_32     (0x5UL)  /*!< Value 0x00000005 */
+#define BLOCK4KCOUNT_64     (0x6UL)  /*!< Value 0x00000006 */
+#define BLOCK4KCOUNT_128    (0x7UL)  /*!< Value 0x00000007 */
+#define BLOCK4KCOUNT_256    (0x8UL)  /*!< Value 0x00000008 */
+#define BLOCK4KCOUNT_512    (0x9UL)  /*!< Value 0x00000009 */
+#define BLOCK4KCOUNT_1024   (0xAUL)  /*!< Value 0x0000000A */
+#define BLOCK4KCOUNT_2048   (0xBUL)  /*!< Value 0x0000000B */
+#define BLOCK4KCOUNT_4096   (0xCUL)  /*!< Value 0x0000000C */
+#define BLOCK4KCOUNT_8192   (0xDUL)  /*!< Value 0x0000000D */
+#define BLOCK4KCOUNT_16384  (0xEUL)  /*!< Value 0x0000000E */
+#define BLOCK4KCOUNT_32728  (0xFUL)  /*!< Value 0x0000000F */
 
 /** @} */ // End of CoreSight group
 
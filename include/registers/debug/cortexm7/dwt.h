@@ -9,6 +9,7 @@
 */
 
 #include <stdint.h>
+#include "global/cortexm7.h"
 #include "registers/debug/common/dwt.h"
 #include "registers/debug/common/coresight.h"
 
@@ -26,8 +27,8 @@
  */
 
 #define CORTEXM7DWT_OFFSET 0x1000UL
-#define CORTEXM7DWT_BASE OFFSET_ADDRESS(PPB_BASE, CORTEXM7DWT_OFFSET)
-#define CORTEXM7DWT REGISTER_PTR(cortexm7dwt_regs, CORTEXM7DWT_BASE)
+#define CORTEXM7DWT_BASE OFFSET_ADDRESS(CORTEXM7PPB_BASE, CORTEXM7DWT_OFFSET)
+#define CORTEXM7DWT REGISTER_PTR(dwt_regs, CORTEXM7DWT_BASE)
 
 /** @} */ // End of CortexM7DWT group
 
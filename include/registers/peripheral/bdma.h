@@ -0,0 +1,167 @@
+#ifndef BDMA_REGISTERS_H
+#define BDMA_REGISTERS_H
+/**
+ * @copyright
+ * @file bdma.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Basic direct memory access (BDMA) controller and its request multiplexer (DMAMUX2) registers
+*/
+
+#include <stdint.h>
+
+#include "global/peripherals.h"
+
+/**
+ *  @defgroup RegisterGroup Register global macros, structure and functions
+ *  @brief Registers global macros, structure and functions
+ *  @{
+ */
+
+/**
+ *  @ingroup RegisterGroup
+ *  @defgroup BasicDirectMemoryAccess Basic direct memory access
+ *  @brief Basic direct memory access macros and structures
+ *  @{
+ */
+
+/*!< Number of channels */
+#define BDMA_CHANNEL_NUMBER 8U
+
+typedef struct {
+	RW uint32_t CCR;         /*!< Channel configuration register     (Offset 0x0)  */
+	RW uint32_t CNDTR;       /*!< Channel number of data register    (Offset 0x4)  */
+	RW uint32_t CPAR;        /*!< Channel peripheral address         (Offset 0x8)  */
+	RW uint32_t CM0AR;       /*!< Channel memory 0 address           (Offset 0xC)  */
+	RW uint32_t CM1AR;       /*!< Channel memory 1 address           (Offset 0x10) */
+} bdma_channel_regs;
+
+typedef struct {
+	RO uint32_t ISR;                                     /*!< Interrupt status register      (Offset 0x0)          */
+	WO uint32_t IFCR;                                    /*!< Interrupt flag clear register  (Offset 0x4)          */
+	   bdma_channel_regs CHANNEL[BDMA_CHANNEL_NUMBER];   /*!< Channel registers              (Offset 0x8 to 0xA4)  */
+} bdma_regs;
+
+typedef struct {
+	RW uint32_t CCR[BDMA_CHANNEL_NUMBER];   /*!< Request line multiplexer channel configuration registers  (Offset 0x0 to 0x1C)   */
+	   uint32_t reserved0[24U];             /*!< Reserved                                                  (Offset 0x20 to 0x7C)  */
+	RO uint32_t CSR;                        /*!< Request line multiplexer interrupt channel status register (Offset 0x80)         */
+	WO uint32_t CFR;                        /*!< Request line multiplexer interrupt clear flag register    (Offset 0x84)          */
+} dmamux_regs;
+
+/*!< Basic direct memory access registers */
+/*!< Interrupt status and flag clear registers. Each channel has 4 flags starting at bit 4 * channel */
+#define BDMA_CHANNEL_FLAGS_SHIFT(CHANNEL) (4U * (CHANNEL))
+
+#define BDMA_ISR_TEIF_OFFSET  (3U)
+#define BDMA_ISR_TEIF_MASK    (0x1UL << REGISTER_FIELD_OFFSET(BDMA, ISR, TEIF))  /*!< Mask  0x00000008 */
+
+#define BDMA_ISR_HTIF_OFFSET  (2U)
+#define BDMA_ISR_HTIF_MASK    (0x1UL << REGISTER_FIELD_OFFSET(BDMA, ISR, HTIF))  /*!< Mask  0x00000004 */
+
+#define BDMA_ISR_TCIF_OFFSET  (1U)
+#define BDMA_ISR_TCIF_MASK    (0x1UL << REGISTER_FIELD_OFFSET(BDMA, ISR, TCIF))  /*!< Mask  0x00000002 */
+
+#define BDMA_ISR_GIF_OFFSET   (0U)
+#define BDMA_ISR_GIF_MASK     (0x1UL << REGISTER_FIELD_OFFSET(BDMA, ISR, GIF))   /*!< Mask  0x00000001 */
+
+/*!< Channel configuration register */
+#define BDMA_CCR_PL_OFFSET     (12U)
+#define BDMA_CCR_PL_MASK       (0x3UL << REGISTER_FIELD_OFFSET(BDMA, CCR, PL))     /*!< Mask  0x00003000 */
+
+#define BDMA_CCR_MSIZE_OFFSET  (10U)
+#define BDMA_CCR_MSIZE_MASK    (0x3UL << REGISTER_FIELD_OFFSET(BDMA, CCR, MSIZE))  /*!< Mask  0x00000C00 */
+
+#define BDMA_CCR_PSIZE_OFFSET  (8U)
+#define BDMA_CCR_PSIZE_MASK    (0x3UL << REGISTER_FIELD_OFFSET(BDMA, CCR, PSIZE))  /*!< Mask  0x00000300 */
+
+#define BDMA_CCR_MINC_OFFSET   (7U)
+#define BDMA_CCR_MINC_MASK     (0x1UL << REGISTER_FIELD_OFFSET(BDMA, CCR, MINC))   /*!< Mask  0x00000080 */
+
+#define BDMA_CCR_PINC_OFFSET   (6U)
+#define BDMA_CCR_PINC_MASK     (0x1UL << REGISTER_FIELD_OFFSET(BDMA, CCR, PINC))   /*!< Mask  0x00000040 */
+
+#define BDMA_CCR_CIRC_OFFSET   (5U)
+#define BDMA_CCR_CIRC_MASK     (0x1UL << REGISTER_FIELD_OFFSET(BDMA, CCR, CIRC))   /*!< Mask  0x00000020 */
+
+#define BDMA_CCR_DIR_OFFSET    (4U)
+#define BDMA_CCR_DIR_MASK      (0x1UL << REGISTER_FIELD_OFFSET(BDMA, CCR, DIR))    /*!< Mask  0x00000010 */
+
+#define BDMA_CCR_TEIE_OFFSET   (3U)
+#define BDMA_CCR_TEIE_MASK     (0x1UL << REGISTER_FIELD_OFFSET(BDMA, CCR, TEIE))   /*!< Mask  0x00000008 */
+
+#define BDMA_CCR_HTIE_OFFSET   (2U)
+#define BDMA_CCR_HTIE_MASK     (0x1UL << REGISTER_FIELD_OFFSET(BDMA, CCR, HTIE))   /*!< Mask  0x00000004 */
+
+#define BDMA_CCR_TCIE_OFFSET   (1U)
+#define BDMA_CCR_TCIE_MASK     (0x1UL << REGISTER_FIELD_OFFSET(BDMA, CCR, TCIE))   /*!< Mask  0x00000002 */
+
+#define BDMA_CCR_EN_OFFSET     (0U)
+#define BDMA_CCR_EN_MASK       (0x1UL << REGISTER_FIELD_OFFSET(BDMA, CCR, EN))     /*!< Mask  0x00000001 */
+
+// Values of priority level
+#define BDMA_PRIORITY_LOW       (0x0UL)  /*!< Value 0x00000000 */
+#define BDMA_PRIORITY_MEDIUM    (0x1UL)  /*!< Value 0x00000001 */
+#define BDMA_PRIORITY_HIGH      (0x2UL)  /*!< Value 0x00000002 */
+#define BDMA_PRIORITY_VERYHIGH  (0x3UL)  /*!< Value 0x00000003 */
+
+// Values of peripheral and memory data size
+#define BDMA_SIZE_8BITS   (0x0UL)  /*!< Value 0x00000000 */
+#define BDMA_SIZE_16BITS  (0x1UL)  /*!< Value 0x00000001 */
+#define BDMA_SIZE_32BITS  (0x2UL)  /*!< Value 0x00000002 */
+
+// Values of address increment bits
+#define BDMA_INCREMENT_DISABLE  (0x0UL)  /*!< Value 0x00000000 */
+#define BDMA_INCREMENT_ENABLE   (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of circular mode bit
+#define BDMA_CIRCULAR_DISABLE  (0x0UL)  /*!< Value 0x00000000 */
+#define BDMA_CIRCULAR_ENABLE   (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of data transfer direction bit
+#define BDMA_DIRECTION_FROMPERIPHERAL  (0x0UL)  /*!< Value 0x00000000 */
+#define BDMA_DIRECTION_FROMMEMORY      (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of interrupt enable bits
+#define BDMA_INT_DISABLE  (0x0UL)  /*!< Value 0x00000000 */
+#define BDMA_INT_ENABLE   (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of channel enable bit
+#define BDMA_CHANNEL_DISABLE  (0x0UL)  /*!< Value 0x00000000 */
+#define BDMA_CHANNEL_ENABLE   (0x1UL)  /*!< Value 0x00000001 */
+
+/*!< Channel number of data register */
+#define BDMA_CNDTR_NDT_OFFSET  (0U)
+#define BDMA_CNDTR_NDT_MASK    (0xFFFFUL << REGISTER_FIELD_OFFSET(BDMA, CNDTR, NDT))  /*!< Mask  0x0000FFFF */
+
+/*!< Request line multiplexer registers */
+/*!< Request line multiplexer channel configuration register */
+#define DMAMUX_CCR_DMAREQ_ID_OFFSET  (0U)
+#define DMAMUX_CCR_DMAREQ_ID_MASK    (0xFFUL << REGISTER_FIELD_OFFSET(DMAMUX, CCR, DMAREQ_ID))  /*!< Mask  0x000000FF */
+
+// Values of DMAMUX2 request inputs
+#define DMAMUX2_REQUEST_LPUART1_RX  (0x09UL)  /*!< Value 0x00000009 */
+#define DMAMUX2_REQUEST_LPUART1_TX  (0x0AUL)  /*!< Value 0x0000000A */
+#define DMAMUX2_REQUEST_SPI6_RX     (0x0BUL)  /*!< Value 0x0000000B */
+#define DMAMUX2_REQUEST_SPI6_TX     (0x0CUL)  /*!< Value 0x0000000C */
+#define DMAMUX2_REQUEST_I2C4_RX     (0x0DUL)  /*!< Value 0x0000000D */
+#define DMAMUX2_REQUEST_I2C4_TX     (0x0EUL)  /*!< Value 0x0000000E */
+#define DMAMUX2_REQUEST_SAI4_A      (0x0FUL)  /*!< Value 0x0000000F */
+#define DMAMUX2_REQUEST_SAI4_B      (0x10UL)  /*!< Value 0x00000010 */
+#define DMAMUX2_REQUEST_ADC3        (0x11UL)  /*!< Value 0x00000011 */
+
+/*!< BDMA registers */
+#define BDMA_OFFSET 0x5400UL
+#define BDMA_BASE OFFSET_ADDRESS(D3_AHB4_BASE, BDMA_OFFSET)
+#define BDMA_COMMON REGISTER_PTR(bdma_regs, BDMA_BASE)
+
+/*!< DMAMUX2 registers. Channel x of DMAMUX2 drives channel x of the BDMA */
+#define DMAMUX2_OFFSET 0x5800UL
+#define DMAMUX2_BASE OFFSET_ADDRESS(D3_AHB4_BASE, DMAMUX2_OFFSET)
+#define DMAMUX2_COMMON REGISTER_PTR(dmamux_regs, DMAMUX2_BASE)
+
+/** @} */ // End of BasicDirectMemoryAccess group
+
+/** @} */ // End of RegisterGroup group
+
+#endif // BDMA_REGISTERS_H
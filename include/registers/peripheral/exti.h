@@ -0,0 +1,84 @@
+#ifndef EXTI_REGISTERS_H
+#define EXTI_REGISTERS_H
+/**
+ * @copyright
+ * @file exti.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Extended interrupts and events controller (EXTI) registers
+*/
+
+#include <stdint.h>
+
+#include "global/peripherals.h"
+
+/**
+ *  @defgroup RegisterGroup Register global macros, structure and functions
+ *  @brief Registers global macros, structure and functions
+ *  @{
+ */
+
+/**
+ *  @ingroup RegisterGroup
+ *  @defgroup ExtendedInterrupts Extended interrupts and events controller
+ *  @brief Extended interrupts and events controller macros and structures
+ *  @{
+ */
+
+typedef struct {
+	RW uint32_t RTSR1;           /*!< Rising trigger selection register 1              (Offset 0x0)          */
+	RW uint32_t FTSR1;           /*!< Falling trigger selection register 1             (Offset 0x4)          */
+	RW uint32_t SWIER1;          /*!< Software interrupt event register 1              (Offset 0x8)          */
+	RW uint32_t D3PMR1;          /*!< D3 pending mask register 1                       (Offset 0xC)          */
+	RW uint32_t D3PCR1L;         /*!< D3 pending clear selection register low 1        (Offset 0x10)         */
+	RW uint32_t D3PCR1H;         /*!< D3 pending clear selection register high 1       (Offset 0x14)         */
+	   uint32_t reserved0[2U];   /*!< Reserved                                         (Offset 0x18 to 0x1C) */
+	RW uint32_t RTSR2;           /*!< Rising trigger selection register 2              (Offset 0x20)         */
+	RW uint32_t FTSR2;           /*!< Falling trigger selection register 2             (Offset 0x24)         */
+	RW uint32_t SWIER2;          /*!< Software interrupt event register 2              (Offset 0x28)         */
+	RW uint32_t D3PMR2;          /*!< D3 pending mask register 2                       (Offset 0x2C)         */
+	RW uint32_t D3PCR2L;         /*!< D3 pending clear selection register low 2        (Offset 0x30)         */
+	RW uint32_t D3PCR2H;         /*!< D3 pending clear selection register high 2       (Offset 0x34)         */
+	   uint32_t reserved1[2U];   /*!< Reserved                                         (Offset 0x38 to 0x3C) */
+	RW uint32_t RTSR3;           /*!< Rising trigger selection register 3              (Offset 0x40)         */
+	RW uint32_t FTSR3;           /*!< Falling trigger selection register 3             (Offset 0x44)         */
+	RW uint32_t SWIER3;          /*!< Software interrupt event register 3              (Offset 0x48)         */
+	RW uint32_t D3PMR3;          /*!< D3 pending mask register 3                       (Offset 0x4C)         */
+	RW uint32_t D3PCR3L;         /*!< D3 pending clear selection register low 3        (Offset 0x50)         */
+	RW uint32_t D3PCR3H;         /*!< D3 pending clear selection register high 3       (Offset 0x54)         */
+	   uint32_t reserved2[10U];  /*!< Reserved                                         (Offset 0x58 to 0x7C) */
+	RW uint32_t C1IMR1;          /*!< CPU1 interrupt mask register 1                   (Offset 0x80)         */
+	RW uint32_t C1EMR1;          /*!< CPU1 event mask register 1                       (Offset 0x84)         */
+	RW uint32_t C1PR1;           /*!< CPU1 pending register 1                          (Offset 0x88)         */
+	   uint32_t reserved3;       /*!< Reserved                                         (Offset 0x8C)         */
+	RW uint32_t C1IMR2;          /*!< CPU1 interrupt mask register 2                   (Offset 0x90)         */
+	RW uint32_t C1EMR2;          /*!< CPU1 event mask register 2                       (Offset 0x94)         */
+	RW uint32_t C1PR2;           /*!< CPU1 pending register 2                          (Offset 0x98)         */
+	   uint32_t reserved4;       /*!< Reserved                                         (Offset 0x9C)         */
+	RW uint32_t C1IMR3;          /*!< CPU1 interrupt mask register 3                   (Offset 0xA0)         */
+	RW uint32_t C1EMR3;          /*!< CPU1 event mask register 3                       (Offset 0xA4)         */
+	RW uint32_t C1PR3;           /*!< CPU1 pending register 3                          (Offset 0xA8)         */
+} exti_regs;
+
+/*!< Extended interrupts and events controller registers */
+/*!< Every register of a group has one bit per event input. Group 1 covers inputs 0 to 31, group 2 inputs 32 to 63 and group 3 inputs 64 to 95 */
+#define EXTI_LINE_MASK(LINE) (0x1UL << ((LINE) % 32U))
+
+// Event inputs of group 1 connected to the real time clock
+#define EXTI_LINE_RTC_ALARM   (17U)  /*!< RTC alarms */
+#define EXTI_LINE_RTC_TAMPER  (18U)  /*!< RTC tamper, timestamp and RCC LSECSS */
+#define EXTI_LINE_RTC_WAKEUP  (19U)  /*!< RTC wakeup timer */
+
+// Event inputs of group 3 connected to the BDMA channel interrupts. They are direct events hence they have no trigger selection
+#define EXTI_LINE_BDMA_CH0    (66U)  /*!< BDMA channel 0 interrupt */
+
+/*!< EXTI registers */
+#define EXTI_OFFSET 0x0000UL
+#define EXTI_BASE OFFSET_ADDRESS(D3_APB4_BASE, EXTI_OFFSET)
+#define EXTI_COMMON REGISTER_PTR(exti_regs, EXTI_BASE)
+
+/** @} */ // End of ExtendedInterrupts group
+
+/** @} */ // End of RegisterGroup group
+
+#endif // EXTI_REGISTERS_H
@@ -360,7 +360,7 @@ typedef struct {
 #define FLASH_SR_CRCBUSY_MASK     (0x1UL << REGISTER_FIELD_OFFSET(FLASH, SR, CRCBUSY))   /*!< Mask  0x00000008 */
 
 #define FLASH_SR_QW_OFFSET        (2U)
-#define FLASH_SR_QW_MASK          (0x1UL << REGISTER_FIELD_OFFSET(FLASH, SR, QWFLAG))    /*!< Mask  0x00000004 */
+#define FLASH_SR_QW_MASK          (0x1UL << REGISTER_FIELD_OFFSET(FLASH, SR, QW))        /*!< Mask  0x00000004 */
 
 #define FLASH_SR_WBNE_OFFSET      (1U)
 #define FLASH_SR_WBNE_MASK        (0x1UL << REGISTER_FIELD_OFFSET(FLASH, SR, WBNE))      /*!< Mask  0x00000002 */
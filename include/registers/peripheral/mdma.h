@@ -0,0 +1,346 @@
+#ifndef MDMA_REGISTERS_H
+#define MDMA_REGISTERS_H
+/**
+ * @copyright
+ * @file mdma.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Master direct memory access (MDMA) controller registers
+*/
+
+#include <stdint.h>
+
+#include "global/peripherals.h"
+
+/**
+ *  @defgroup RegisterGroup Register global macros, structure and functions
+ *  @brief Registers global macros, structure and functions
+ *  @{
+ */
+
+/**
+ *  @ingroup RegisterGroup
+ *  @defgroup MDMA Master direct memory access (MDMA) controller
+ *  @brief Master direct memory access (MDMA) controller macros and structures
+ *  @{
+ */
+
+typedef struct {
+	RO uint32_t GISR0;          /*!< Global interrupt status register  (Offset 0x0)         */
+	   uint32_t reserved0[15U]; /*!< Reserved                          (Offset 0x4 to 0x3C) */
+} mdma_regs;
+
+typedef struct {
+	RO uint32_t ISR;           /*!< Channel interrupt status register             (Offset 0x0)          */
+	WO uint32_t IFCR;          /*!< Channel interrupt flag clear register         (Offset 0x4)          */
+	RO uint32_t ESR;           /*!< Channel error status register                 (Offset 0x8)          */
+	RW uint32_t CR;            /*!< Channel control register                      (Offset 0xC)          */
+	RW uint32_t TCR;           /*!< Channel transfer configuration register       (Offset 0x10)         */
+	RW uint32_t BNDTR;         /*!< Channel block number of data register         (Offset 0x14)         */
+	RW uint32_t SAR;           /*!< Channel source address register               (Offset 0x18)         */
+	RW uint32_t DAR;           /*!< Channel destination address register          (Offset 0x1C)         */
+	RW uint32_t BRUR;          /*!< Channel block repeat address update register  (Offset 0x20)         */
+	RW uint32_t LAR;           /*!< Channel link address register                 (Offset 0x24)         */
+	RW uint32_t TBR;           /*!< Channel trigger and bus selection register    (Offset 0x28)         */
+	   uint32_t reserved0;     /*!< Reserved                                      (Offset 0x2C)         */
+	RW uint32_t MAR;           /*!< Channel mask address register                 (Offset 0x30)         */
+	RW uint32_t MDR;           /*!< Channel mask data register                    (Offset 0x34)         */
+	   uint32_t reserved1[2U]; /*!< Reserved                                      (Offset 0x38 to 0x3C) */
+} mdma_channel_regs;
+
+/*!< Master direct memory access (MDMA) controller registers */
+/*!< Global interrupt status register */
+#define MDMA_GISR0_GIF_OFFSET  (0U)
+#define MDMA_GISR0_GIF_MASK    (0xFFFFUL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))      /*!< Mask  0x0000FFFF */
+#define MDMA_GISR0_GIF_0       (0x00000001UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00000001 */
+#define MDMA_GISR0_GIF_1       (0x00000002UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00000002 */
+#define MDMA_GISR0_GIF_2       (0x00000004UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00000004 */
+#define MDMA_GISR0_GIF_3       (0x00000008UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00000008 */
+#define MDMA_GISR0_GIF_4       (0x00000010UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00000010 */
+#define MDMA_GISR0_GIF_5       (0x00000020UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00000020 */
+#define MDMA_GISR0_GIF_6       (0x00000040UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00000040 */
+#define MDMA_GISR0_GIF_7       (0x00000080UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00000080 */
+#define MDMA_GISR0_GIF_8       (0x00000100UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00000100 */
+#define MDMA_GISR0_GIF_9       (0x00000200UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00000200 */
+#define MDMA_GISR0_GIF_10      (0x00000400UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00000400 */
+#define MDMA_GISR0_GIF_11      (0x00000800UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00000800 */
+#define MDMA_GISR0_GIF_12      (0x00001000UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00001000 */
+#define MDMA_GISR0_GIF_13      (0x00002000UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00002000 */
+#define MDMA_GISR0_GIF_14      (0x00004000UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00004000 */
+#define MDMA_GISR0_GIF_15      (0x00008000UL << REGISTER_FIELD_OFFSET(MDMA, GISR0, GIF))  /*!< Value 0x00008000 */
+
+/*!< Channel interrupt status register */
+#define MDMA_ISR_CRQA_OFFSET   (16U)
+#define MDMA_ISR_CRQA_MASK     (0x1UL << REGISTER_FIELD_OFFSET(MDMA, ISR, CRQA))   /*!< Mask  0x00010000 */
+
+#define MDMA_ISR_TCIF_OFFSET   (4U)
+#define MDMA_ISR_TCIF_MASK     (0x1UL << REGISTER_FIELD_OFFSET(MDMA, ISR, TCIF))   /*!< Mask  0x00000010 */
+
+#define MDMA_ISR_BTIF_OFFSET   (3U)
+#define MDMA_ISR_BTIF_MASK     (0x1UL << REGISTER_FIELD_OFFSET(MDMA, ISR, BTIF))   /*!< Mask  0x00000008 */
+
+#define MDMA_ISR_BRTIF_OFFSET  (2U)
+#define MDMA_ISR_BRTIF_MASK    (0x1UL << REGISTER_FIELD_OFFSET(MDMA, ISR, BRTIF))  /*!< Mask  0x00000004 */
+
+#define MDMA_ISR_CTCIF_OFFSET  (1U)
+#define MDMA_ISR_CTCIF_MASK    (0x1UL << REGISTER_FIELD_OFFSET(MDMA, ISR, CTCIF))  /*!< Mask  0x00000002 */
+
+#define MDMA_ISR_TEIF_OFFSET   (0U)
+#define MDMA_ISR_TEIF_MASK     (0x1UL << REGISTER_FIELD_OFFSET(MDMA, ISR, TEIF))   /*!< Mask  0x00000001 */
+
+// Values of channel request active flag
+#define MDMA_REQUEST_INACTIVE  (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_REQUEST_ACTIVE    (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of channel interrupt flags
+#define MDMA_INTFLAG_CLEARED  (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_INTFLAG_SET      (0x1UL)  /*!< Value 0x00000001 */
+
+/*!< Channel interrupt flag clear register */
+#define MDMA_IFCR_CLTCIF_OFFSET  (4U)
+#define MDMA_IFCR_CLTCIF_MASK    (0x1UL << REGISTER_FIELD_OFFSET(MDMA, IFCR, CLTCIF))  /*!< Mask  0x00000010 */
+
+#define MDMA_IFCR_CBTIF_OFFSET   (3U)
+#define MDMA_IFCR_CBTIF_MASK     (0x1UL << REGISTER_FIELD_OFFSET(MDMA, IFCR, CBTIF))   /*!< Mask  0x00000008 */
+
+#define MDMA_IFCR_CBRTIF_OFFSET  (2U)
+#define MDMA_IFCR_CBRTIF_MASK    (0x1UL << REGISTER_FIELD_OFFSET(MDMA, IFCR, CBRTIF))  /*!< Mask  0x00000004 */
+
+#define MDMA_IFCR_CCTCIF_OFFSET  (1U)
+#define MDMA_IFCR_CCTCIF_MASK    (0x1UL << REGISTER_FIELD_OFFSET(MDMA, IFCR, CCTCIF))  /*!< Mask  0x00000002 */
+
+#define MDMA_IFCR_CTEIF_OFFSET   (0U)
+#define MDMA_IFCR_CTEIF_MASK     (0x1UL << REGISTER_FIELD_OFFSET(MDMA, IFCR, CTEIF))   /*!< Mask  0x00000001 */
+
+// Values of channel interrupt flag clear bits
+#define MDMA_INTFLAG_NOCLEAR  (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_INTFLAG_CLEAR    (0x1UL)  /*!< Value 0x00000001 */
+
+/*!< Channel control register */
+#define MDMA_CR_SWRQ_OFFSET   (16U)
+#define MDMA_CR_SWRQ_MASK     (0x1UL << REGISTER_FIELD_OFFSET(MDMA, CR, SWRQ))   /*!< Mask  0x00010000 */
+
+#define MDMA_CR_BEX_OFFSET    (14U)
+#define MDMA_CR_BEX_MASK      (0x1UL << REGISTER_FIELD_OFFSET(MDMA, CR, BEX))    /*!< Mask  0x00004000 */
+
+#define MDMA_CR_HEX_OFFSET    (13U)
+#define MDMA_CR_HEX_MASK      (0x1UL << REGISTER_FIELD_OFFSET(MDMA, CR, HEX))    /*!< Mask  0x00002000 */
+
+#define MDMA_CR_WEX_OFFSET    (12U)
+#define MDMA_CR_WEX_MASK      (0x1UL << REGISTER_FIELD_OFFSET(MDMA, CR, WEX))    /*!< Mask  0x00001000 */
+
+#define MDMA_CR_PL_OFFSET     (6U)
+#define MDMA_CR_PL_MASK       (0x3UL << REGISTER_FIELD_OFFSET(MDMA, CR, PL))     /*!< Mask  0x000000C0 */
+
+#define MDMA_CR_TCIE_OFFSET   (5U)
+#define MDMA_CR_TCIE_MASK     (0x1UL << REGISTER_FIELD_OFFSET(MDMA, CR, TCIE))   /*!< Mask  0x00000020 */
+
+#define MDMA_CR_BTIE_OFFSET   (4U)
+#define MDMA_CR_BTIE_MASK     (0x1UL << REGISTER_FIELD_OFFSET(MDMA, CR, BTIE))   /*!< Mask  0x00000010 */
+
+#define MDMA_CR_BRTIE_OFFSET  (3U)
+#define MDMA_CR_BRTIE_MASK    (0x1UL << REGISTER_FIELD_OFFSET(MDMA, CR, BRTIE))  /*!< Mask  0x00000008 */
+
+#define MDMA_CR_CTCIE_OFFSET  (2U)
+#define MDMA_CR_CTCIE_MASK    (0x1UL << REGISTER_FIELD_OFFSET(MDMA, CR, CTCIE))  /*!< Mask  0x00000004 */
+
+#define MDMA_CR_TEIE_OFFSET   (1U)
+#define MDMA_CR_TEIE_MASK     (0x1UL << REGISTER_FIELD_OFFSET(MDMA, CR, TEIE))   /*!< Mask  0x00000002 */
+
+#define MDMA_CR_EN_OFFSET     (0U)
+#define MDMA_CR_EN_MASK       (0x1UL << REGISTER_FIELD_OFFSET(MDMA, CR, EN))     /*!< Mask  0x00000001 */
+
+// Values of channel software request bit
+#define MDMA_SWREQUEST_NONE      (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_SWREQUEST_ACTIVATE  (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of channel byte, half word and word endianness exchange bits
+#define MDMA_ENDIANNESS_PRESERVE  (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_ENDIANNESS_EXCHANGE  (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of channel priority level register
+#define MDMA_PRIORITY_LOW       (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_PRIORITY_MEDIUM    (0x1UL)  /*!< Value 0x00000001 */
+#define MDMA_PRIORITY_HIGH      (0x2UL)  /*!< Value 0x00000002 */
+#define MDMA_PRIORITY_VERYHIGH  (0x3UL)  /*!< Value 0x00000003 */
+
+// Values of channel interrupt enable bits
+#define MDMA_INT_DISABLE  (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_INT_ENABLE   (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of channel enable bit
+#define MDMA_CHANNEL_DISABLE  (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_CHANNEL_ENABLE   (0x1UL)  /*!< Value 0x00000001 */
+
+/*!< Channel transfer configuration register */
+#define MDMA_TCR_BWM_OFFSET     (31U)
+#define MDMA_TCR_BWM_MASK       (0x1UL << REGISTER_FIELD_OFFSET(MDMA, TCR, BWM))          /*!< Mask  0x80000000 */
+
+#define MDMA_TCR_SWRM_OFFSET    (30U)
+#define MDMA_TCR_SWRM_MASK      (0x1UL << REGISTER_FIELD_OFFSET(MDMA, TCR, SWRM))         /*!< Mask  0x40000000 */
+
+#define MDMA_TCR_TRGM_OFFSET    (28U)
+#define MDMA_TCR_TRGM_MASK      (0x3UL << REGISTER_FIELD_OFFSET(MDMA, TCR, TRGM))         /*!< Mask  0x30000000 */
+
+#define MDMA_TCR_PAM_OFFSET     (26U)
+#define MDMA_TCR_PAM_MASK       (0x3UL << REGISTER_FIELD_OFFSET(MDMA, TCR, PAM))          /*!< Mask  0x0C000000 */
+
+#define MDMA_TCR_PKE_OFFSET     (25U)
+#define MDMA_TCR_PKE_MASK       (0x1UL << REGISTER_FIELD_OFFSET(MDMA, TCR, PKE))          /*!< Mask  0x02000000 */
+
+#define MDMA_TCR_TLEN_OFFSET    (18U)
+#define MDMA_TCR_TLEN_MASK      (0x7FUL << REGISTER_FIELD_OFFSET(MDMA, TCR, TLEN))        /*!< Mask  0x01FC0000 */
+#define MDMA_TCR_TLEN_0         (0x00000001UL << REGISTER_FIELD_OFFSET(MDMA, TCR, TLEN))  /*!< Value 0x00040000 */
+#define MDMA_TCR_TLEN_1         (0x00000002UL << REGISTER_FIELD_OFFSET(MDMA, TCR, TLEN))  /*!< Value 0x00080000 */
+#define MDMA_TCR_TLEN_2         (0x00000004UL << REGISTER_FIELD_OFFSET(MDMA, TCR, TLEN))  /*!< Value 0x00100000 */
+#define MDMA_TCR_TLEN_3         (0x00000008UL << REGISTER_FIELD_OFFSET(MDMA, TCR, TLEN))  /*!< Value 0x00200000 */
+#define MDMA_TCR_TLEN_4         (0x00000010UL << REGISTER_FIELD_OFFSET(MDMA, TCR, TLEN))  /*!< Value 0x00400000 */
+#define MDMA_TCR_TLEN_5         (0x00000020UL << REGISTER_FIELD_OFFSET(MDMA, TCR, TLEN))  /*!< Value 0x00800000 */
+#define MDMA_TCR_TLEN_6         (0x00000040UL << REGISTER_FIELD_OFFSET(MDMA, TCR, TLEN))  /*!< Value 0x01000000 */
+
+#define MDMA_TCR_DBURST_OFFSET  (15U)
+#define MDMA_TCR_DBURST_MASK    (0x7UL << REGISTER_FIELD_OFFSET(MDMA, TCR, DBURST))       /*!< Mask  0x00038000 */
+
+#define MDMA_TCR_SBURST_OFFSET  (12U)
+#define MDMA_TCR_SBURST_MASK    (0x7UL << REGISTER_FIELD_OFFSET(MDMA, TCR, SBURST))       /*!< Mask  0x00007000 */
+
+#define MDMA_TCR_DINCOS_OFFSET  (10U)
+#define MDMA_TCR_DINCOS_MASK    (0x3UL << REGISTER_FIELD_OFFSET(MDMA, TCR, DINCOS))       /*!< Mask  0x00000C00 */
+
+#define MDMA_TCR_SINCOS_OFFSET  (8U)
+#define MDMA_TCR_SINCOS_MASK    (0x3UL << REGISTER_FIELD_OFFSET(MDMA, TCR, SINCOS))       /*!< Mask  0x00000300 */
+
+#define MDMA_TCR_DSIZE_OFFSET   (6U)
+#define MDMA_TCR_DSIZE_MASK     (0x3UL << REGISTER_FIELD_OFFSET(MDMA, TCR, DSIZE))        /*!< Mask  0x000000C0 */
+
+#define MDMA_TCR_SSIZE_OFFSET   (4U)
+#define MDMA_TCR_SSIZE_MASK     (0x3UL << REGISTER_FIELD_OFFSET(MDMA, TCR, SSIZE))        /*!< Mask  0x00000030 */
+
+#define MDMA_TCR_DINC_OFFSET    (2U)
+#define MDMA_TCR_DINC_MASK      (0x3UL << REGISTER_FIELD_OFFSET(MDMA, TCR, DINC))         /*!< Mask  0x0000000C */
+
+#define MDMA_TCR_SINC_OFFSET    (0U)
+#define MDMA_TCR_SINC_MASK      (0x3UL << REGISTER_FIELD_OFFSET(MDMA, TCR, SINC))         /*!< Mask  0x00000003 */
+
+// Values of bufferable write mode bit
+#define MDMA_BUFFERABLEWRITE_DISABLE  (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_BUFFERABLEWRITE_ENABLE   (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of software request mode bit
+#define MDMA_REQUEST_HARDWARE  (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_REQUEST_SOFTWARE  (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of trigger mode register
+#define MDMA_TRIGGER_BUFFER         (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_TRIGGER_BLOCK          (0x1UL)  /*!< Value 0x00000001 */
+#define MDMA_TRIGGER_REPEATEDBLOCK  (0x2UL)  /*!< Value 0x00000002 */
+#define MDMA_TRIGGER_LINKEDLIST     (0x3UL)  /*!< Value 0x00000003 */
+
+// Values of padding and alignment mode register
+#define MDMA_ALIGNMENT_RIGHT        (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_ALIGNMENT_RIGHTSIGNED  (0x1UL)  /*!< Value 0x00000001 */
+#define MDMA_ALIGNMENT_LEFT         (0x2UL)  /*!< Value 0x00000002 */
+
+// Values of burst transfer configuration registers
+#define MDMA_BURST_SINGLE    (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_BURST_2BEATS    (0x1UL)  /*!< Value 0x00000001 */
+#define MDMA_BURST_4BEATS    (0x2UL)  /*!< Value 0x00000002 */
+#define MDMA_BURST_8BEATS    (0x3UL)  /*!< Value 0x00000003 */
+#define MDMA_BURST_16BEATS   (0x4UL)  /*!< Value 0x00000004 */
+#define MDMA_BURST_32BEATS   (0x5UL)  /*!< Value 0x00000005 */
+#define MDMA_BURST_64BEATS   (0x6UL)  /*!< Value 0x00000006 */
+#define MDMA_BURST_128BEATS  (0x7UL)  /*!< Value 0x00000007 */
+
+// Values of data size and address increment offset size registers
+#define MDMA_DATASIZE_BYTE        (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_DATASIZE_HALFWORD    (0x1UL)  /*!< Value 0x00000001 */
+#define MDMA_DATASIZE_WORD        (0x2UL)  /*!< Value 0x00000002 */
+#define MDMA_DATASIZE_DOUBLEWORD  (0x3UL)  /*!< Value 0x00000003 */
+
+// Values of address increment mode registers
+#define MDMA_ADDRESS_FIXED      (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_ADDRESS_INCREMENT  (0x2UL)  /*!< Value 0x00000002 */
+#define MDMA_ADDRESS_DECREMENT  (0x3UL)  /*!< Value 0x00000003 */
+
+/*!< Channel block number of data register */
+#define MDMA_BNDTR_BRC_OFFSET    (20U)
+#define MDMA_BNDTR_BRC_MASK      (0xFFFUL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRC))        /*!< Mask  0xFFF00000 */
+#define MDMA_BNDTR_BRC_0         (0x00000001UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRC))   /*!< Value 0x00100000 */
+#define MDMA_BNDTR_BRC_1         (0x00000002UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRC))   /*!< Value 0x00200000 */
+#define MDMA_BNDTR_BRC_2         (0x00000004UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRC))   /*!< Value 0x00400000 */
+#define MDMA_BNDTR_BRC_3         (0x00000008UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRC))   /*!< Value 0x00800000 */
+#define MDMA_BNDTR_BRC_4         (0x00000010UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRC))   /*!< Value 0x01000000 */
+#define MDMA_BNDTR_BRC_5         (0x00000020UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRC))   /*!< Value 0x02000000 */
+#define MDMA_BNDTR_BRC_6         (0x00000040UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRC))   /*!< Value 0x04000000 */
+#define MDMA_BNDTR_BRC_7         (0x00000080UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRC))   /*!< Value 0x08000000 */
+#define MDMA_BNDTR_BRC_8         (0x00000100UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRC))   /*!< Value 0x10000000 */
+#define MDMA_BNDTR_BRC_9         (0x00000200UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRC))   /*!< Value 0x20000000 */
+#define MDMA_BNDTR_BRC_10        (0x00000400UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRC))   /*!< Value 0x40000000 */
+#define MDMA_BNDTR_BRC_11        (0x00000800UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRC))   /*!< Value 0x80000000 */
+
+#define MDMA_BNDTR_BRDUM_OFFSET  (19U)
+#define MDMA_BNDTR_BRDUM_MASK    (0x1UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRDUM))        /*!< Mask  0x00080000 */
+
+#define MDMA_BNDTR_BRSUM_OFFSET  (18U)
+#define MDMA_BNDTR_BRSUM_MASK    (0x1UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BRSUM))        /*!< Mask  0x00040000 */
+
+#define MDMA_BNDTR_BNDT_OFFSET   (0U)
+#define MDMA_BNDTR_BNDT_MASK     (0x1FFFFUL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))     /*!< Mask  0x0001FFFF */
+#define MDMA_BNDTR_BNDT_0        (0x00000001UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00000001 */
+#define MDMA_BNDTR_BNDT_1        (0x00000002UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00000002 */
+#define MDMA_BNDTR_BNDT_2        (0x00000004UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00000004 */
+#define MDMA_BNDTR_BNDT_3        (0x00000008UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00000008 */
+#define MDMA_BNDTR_BNDT_4        (0x00000010UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00000010 */
+#define MDMA_BNDTR_BNDT_5        (0x00000020UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00000020 */
+#define MDMA_BNDTR_BNDT_6        (0x00000040UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00000040 */
+#define MDMA_BNDTR_BNDT_7        (0x00000080UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00000080 */
+#define MDMA_BNDTR_BNDT_8        (0x00000100UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00000100 */
+#define MDMA_BNDTR_BNDT_9        (0x00000200UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00000200 */
+#define MDMA_BNDTR_BNDT_10       (0x00000400UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00000400 */
+#define MDMA_BNDTR_BNDT_11       (0x00000800UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00000800 */
+#define MDMA_BNDTR_BNDT_12       (0x00001000UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00001000 */
+#define MDMA_BNDTR_BNDT_13       (0x00002000UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00002000 */
+#define MDMA_BNDTR_BNDT_14       (0x00004000UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00004000 */
+#define MDMA_BNDTR_BNDT_15       (0x00008000UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00008000 */
+#define MDMA_BNDTR_BNDT_16       (0x00010000UL << REGISTER_FIELD_OFFSET(MDMA, BNDTR, BNDT))  /*!< Value 0x00010000 */
+
+// Values of block repeat address update mode bits
+#define MDMA_BLOCKREPEAT_ADDRINCREMENT  (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_BLOCKREPEAT_ADDRDECREMENT  (0x1UL)  /*!< Value 0x00000001 */
+
+/*!< Channel trigger and bus selection register */
+#define MDMA_TBR_DBUS_OFFSET  (17U)
+#define MDMA_TBR_DBUS_MASK    (0x1UL << REGISTER_FIELD_OFFSET(MDMA, TBR, DBUS))         /*!< Mask  0x00020000 */
+
+#define MDMA_TBR_SBUS_OFFSET  (16U)
+#define MDMA_TBR_SBUS_MASK    (0x1UL << REGISTER_FIELD_OFFSET(MDMA, TBR, SBUS))         /*!< Mask  0x00010000 */
+
+#define MDMA_TBR_TSEL_OFFSET  (0U)
+#define MDMA_TBR_TSEL_MASK    (0x3FUL << REGISTER_FIELD_OFFSET(MDMA, TBR, TSEL))        /*!< Mask  0x0000003F */
+#define MDMA_TBR_TSEL_0       (0x00000001UL << REGISTER_FIELD_OFFSET(MDMA, TBR, TSEL))  /*!< Value 0x00000001 */
+#define MDMA_TBR_TSEL_1       (0x00000002UL << REGISTER_FIELD_OFFSET(MDMA, TBR, TSEL))  /*!< Value 0x00000002 */
+#define MDMA_TBR_TSEL_2       (0x00000004UL << REGISTER_FIELD_OFFSET(MDMA, TBR, TSEL))  /*!< Value 0x00000004 */
+#define MDMA_TBR_TSEL_3       (0x00000008UL << REGISTER_FIELD_OFFSET(MDMA, TBR, TSEL))  /*!< Value 0x00000008 */
+#define MDMA_TBR_TSEL_4       (0x00000010UL << REGISTER_FIELD_OFFSET(MDMA, TBR, TSEL))  /*!< Value 0x00000010 */
+#define MDMA_TBR_TSEL_5       (0x00000020UL << REGISTER_FIELD_OFFSET(MDMA, TBR, TSEL))  /*!< Value 0x00000020 */
+
+// Values of bus selection bits
+#define MDMA_BUS_AXI     (0x0UL)  /*!< Value 0x00000000 */
+#define MDMA_BUS_AHBTCM  (0x1UL)  /*!< Value 0x00000001 - AHB bus used to access TCMs */
+
+#define MDMA_OFFSET 0x1000000UL
+#define MDMA_BASE OFFSET_ADDRESS(D1_AHB3_BASE, MDMA_OFFSET)
+#define MDMA_GLOBAL REGISTER_PTR(mdma_regs, MDMA_BASE)
+
+/*!< MDMA channel registers */
+#define MDMA_CHANNEL_BASE_OFFSET 0x40UL
+#define MDMA_CHANNEL_ADDRESS_RANGE 0x40UL
+#define MDMA_CHANNEL_NUMBER 16U
+#define MDMA_CHANNEL_BASE(CHANNEL) OFFSET_ADDRESS(MDMA_BASE, (MDMA_CHANNEL_BASE_OFFSET + ((CHANNEL)*MDMA_CHANNEL_ADDRESS_RANGE)))
+#define MDMA_CHANNEL(CHANNEL) REGISTER_PTR(mdma_channel_regs, MDMA_CHANNEL_BASE(CHANNEL))
+
+/** @} */ // End of MDMA group
+
+/** @} */ // End of RegisterGroup group
+
+#endif // MDMA_REGISTERS_H
@@ -502,7 +502,7 @@ typedef struct {
 /*!< Power control registers */
 #define PWR_OFFSET 0x4800UL
 #define PWR_BASE OFFSET_ADDRESS(D3_AHB4_BASE, PWR_OFFSET)
-#define PWR REGISTER_PTR(power_regs, PWR_BASE)
+#define PWR_COMMON REGISTER_PTR(power_regs, PWR_BASE)
 
 /** @} */ // End of Power control group
 
@@ -164,8 +164,8 @@ typedef struct {
 #define RCC_CR_CSISMON_OFFSET    (9U)
 #define RCC_CR_CSISMON_MASK      (0x1UL << REGISTER_FIELD_OFFSET(RCC, CR, CSISMON))    /*!< Mask  0x00000200 */
 
-#define RCC_CR_CSIKERRDY_OFFSET  (8U)
-#define RCC_CR_CSIKERRDY_MASK    (0x1UL << REGISTER_FIELD_OFFSET(RCC, CR, CSIKERRDY))  /*!< Mask  0x00000100 */
+#define RCC_CR_CSIRDY_OFFSET     (8U)
+#define RCC_CR_CSIRDY_MASK       (0x1UL << REGISTER_FIELD_OFFSET(RCC, CR, CSIRDY))     /*!< Mask  0x00000100 */
 
 #define RCC_CR_CSION_OFFSET      (7U)
 #define RCC_CR_CSION_MASK        (0x1UL << REGISTER_FIELD_OFFSET(RCC, CR, CSION))      /*!< Mask  0x00000080 */
@@ -2066,6 +2066,10 @@ typedef struct {
 #define RCC_RSTSTATUS_ILLEGAL  (0x0UL)  /*!< Value 0x00000000 */
 #define RCC_RSTSTATUS_VALID    (0x1UL)  /*!< Value 0x00000001 */
 
+// Values of remove reset flag bit
+#define RCC_RESETFLAG_KEEP   (0x0UL)  /*!< Value 0x00000000 */
+#define RCC_RESETFLAG_CLEAR  (0x1UL)  /*!< Value 0x00000001 */
+
 /*!< AHB3 clock register */
 #define RCC_AHB3ENR_AXISRAMEN_OFFSET     (31U)
 #define RCC_AHB3ENR_AXISRAMEN_MASK       (0x1UL << REGISTER_FIELD_OFFSET(RCC, AHB3ENR, AXISRAMEN))    /*!< Mask  0x80000000 */
@@ -2488,7 +2492,7 @@ typedef struct {
 
 /*!< AHB4 low power clock register */
 #define RCC_AHB4LPENR_SRAM4LPEN_OFFSET    (29U)
-#define RCC_AHB4LPENR_SRAM4LPEN_MASK      (0x1UL << REGISTER_FIELD_OFFSET(RCC, AHB4LPENR, SRAM1LPEN))   /*!< Mask  0x20000000 */
+#define RCC_AHB4LPENR_SRAM4LPEN_MASK      (0x1UL << REGISTER_FIELD_OFFSET(RCC, AHB4LPENR, SRAM4LPEN))   /*!< Mask  0x20000000 */
 
 #define RCC_AHB4LPENR_BKPRAMLPEN_OFFSET   (28U)
 #define RCC_AHB4LPENR_BKPRAMLPEN_MASK     (0x1UL << REGISTER_FIELD_OFFSET(RCC, AHB4LPENR, BKPRAMLPEN))  /*!< Mask  0x10000000 */
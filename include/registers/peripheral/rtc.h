@@ -0,0 +1,148 @@
+#ifndef RTC_REGISTERS_H
+#define RTC_REGISTERS_H
+/**
+ * @copyright
+ * @file rtc.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Real time clock (RTC) registers
+*/
+
+#include <stdint.h>
+
+#include "global/peripherals.h"
+
+/**
+ *  @defgroup RegisterGroup Register global macros, structure and functions
+ *  @brief Registers global macros, structure and functions
+ *  @{
+ */
+
+/**
+ *  @ingroup RegisterGroup
+ *  @defgroup RealTimeClock Real time clock
+ *  @brief Real time clock macros and structures
+ *  @{
+ */
+
+typedef struct {
+	RW uint32_t TR;          /*!< Time register                              (Offset 0x0)         */
+	RW uint32_t DR;          /*!< Date register                              (Offset 0x4)         */
+	RW uint32_t CR;          /*!< Control register                           (Offset 0x8)         */
+	RW uint32_t ISR;         /*!< Initialization and status register         (Offset 0xC)         */
+	RW uint32_t PRER;        /*!< Prescaler register                         (Offset 0x10)        */
+	RW uint32_t WUTR;        /*!< Wakeup timer register                      (Offset 0x14)        */
+	   uint32_t reserved0;   /*!< Reserved                                   (Offset 0x18)        */
+	RW uint32_t ALRMAR;      /*!< Alarm A register                           (Offset 0x1C)        */
+	RW uint32_t ALRMBR;      /*!< Alarm B register                           (Offset 0x20)        */
+	WO uint32_t WPR;         /*!< Write protection register                  (Offset 0x24)        */
+	RO uint32_t SSR;         /*!< Sub second register                        (Offset 0x28)        */
+	WO uint32_t SHIFTR;      /*!< Shift control register                     (Offset 0x2C)        */
+	RO uint32_t TSTR;        /*!< Timestamp time register                    (Offset 0x30)        */
+	RO uint32_t TSDR;        /*!< Timestamp date register                    (Offset 0x34)        */
+	RO uint32_t TSSSR;       /*!< Timestamp sub second register              (Offset 0x38)        */
+	RW uint32_t CALR;        /*!< Calibration register                       (Offset 0x3C)        */
+	RW uint32_t TAMPCR;      /*!< Tamper configuration register              (Offset 0x40)        */
+	RW uint32_t ALRMASSR;    /*!< Alarm A sub second register                (Offset 0x44)        */
+	RW uint32_t ALRMBSSR;    /*!< Alarm B sub second register                (Offset 0x48)        */
+	RW uint32_t OR;          /*!< Option register                            (Offset 0x4C)        */
+	RW uint32_t BKPR[32U];   /*!< Backup registers                           (Offset 0x50 to 0xCC) */
+} rtc_regs;
+
+/*!< Real time clock registers */
+/*!< Control register */
+#define RTC_CR_WUTIE_OFFSET    (14U)
+#define RTC_CR_WUTIE_MASK      (0x1UL << REGISTER_FIELD_OFFSET(RTC, CR, WUTIE))    /*!< Mask  0x00004000 */
+
+#define RTC_CR_WUTE_OFFSET     (10U)
+#define RTC_CR_WUTE_MASK       (0x1UL << REGISTER_FIELD_OFFSET(RTC, CR, WUTE))     /*!< Mask  0x00000400 */
+
+#define RTC_CR_BYPSHAD_OFFSET  (5U)
+#define RTC_CR_BYPSHAD_MASK    (0x1UL << REGISTER_FIELD_OFFSET(RTC, CR, BYPSHAD))  /*!< Mask  0x00000020 */
+
+#define RTC_CR_WUCKSEL_OFFSET  (0U)
+#define RTC_CR_WUCKSEL_MASK    (0x7UL << REGISTER_FIELD_OFFSET(RTC, CR, WUCKSEL))  /*!< Mask  0x00000007 */
+
+// Values of wakeup timer interrupt enable bit
+#define RTC_WAKEUPINT_DISABLE  (0x0UL)  /*!< Value 0x00000000 */
+#define RTC_WAKEUPINT_ENABLE   (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of wakeup timer enable bit
+#define RTC_WAKEUP_DISABLE  (0x0UL)  /*!< Value 0x00000000 */
+#define RTC_WAKEUP_ENABLE   (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of bypass the shadow registers bit
+#define RTC_SHADOWREG_USE     (0x0UL)  /*!< Value 0x00000000 */
+#define RTC_SHADOWREG_BYPASS  (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of wakeup clock selection
+#define RTC_WAKEUPCLK_DIV16         (0x0UL)  /*!< Value 0x00000000 */
+#define RTC_WAKEUPCLK_DIV8          (0x1UL)  /*!< Value 0x00000001 */
+#define RTC_WAKEUPCLK_DIV4          (0x2UL)  /*!< Value 0x00000002 */
+#define RTC_WAKEUPCLK_DIV2          (0x3UL)  /*!< Value 0x00000003 */
+#define RTC_WAKEUPCLK_CKSPRE        (0x4UL)  /*!< Value 0x00000004 */
+#define RTC_WAKEUPCLK_CKSPRE_WUT17  (0x6UL)  /*!< Value 0x00000006 */
+
+/*!< Initialization and status register */
+#define RTC_ISR_WUTF_OFFSET   (10U)
+#define RTC_ISR_WUTF_MASK     (0x1UL << REGISTER_FIELD_OFFSET(RTC, ISR, WUTF))   /*!< Mask  0x00000400 */
+
+#define RTC_ISR_INIT_OFFSET   (7U)
+#define RTC_ISR_INIT_MASK     (0x1UL << REGISTER_FIELD_OFFSET(RTC, ISR, INIT))   /*!< Mask  0x00000080 */
+
+#define RTC_ISR_INITF_OFFSET  (6U)
+#define RTC_ISR_INITF_MASK    (0x1UL << REGISTER_FIELD_OFFSET(RTC, ISR, INITF))  /*!< Mask  0x00000040 */
+
+#define RTC_ISR_WUTWF_OFFSET  (2U)
+#define RTC_ISR_WUTWF_MASK    (0x1UL << REGISTER_FIELD_OFFSET(RTC, ISR, WUTWF))  /*!< Mask  0x00000004 */
+
+// Values of wakeup timer flag
+#define RTC_WAKEUPFLAG_NOTEXPIRED  (0x0UL)  /*!< Value 0x00000000 */
+#define RTC_WAKEUPFLAG_EXPIRED     (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of initialization mode bit
+#define RTC_INITMODE_FREERUN  (0x0UL)  /*!< Value 0x00000000 */
+#define RTC_INITMODE_INIT     (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of initialization flag
+#define RTC_INITFLAG_NOTALLOWED  (0x0UL)  /*!< Value 0x00000000 */
+#define RTC_INITFLAG_ALLOWED     (0x1UL)  /*!< Value 0x00000001 */
+
+// Values of wakeup timer write flag
+#define RTC_WAKEUPWRITE_NOTALLOWED  (0x0UL)  /*!< Value 0x00000000 */
+#define RTC_WAKEUPWRITE_ALLOWED     (0x1UL)  /*!< Value 0x00000001 */
+
+/*!< Prescaler register */
+#define RTC_PRER_PREDIV_A_OFFSET  (16U)
+#define RTC_PRER_PREDIV_A_MASK    (0x7FUL << REGISTER_FIELD_OFFSET(RTC, PRER, PREDIV_A))    /*!< Mask  0x007F0000 */
+
+#define RTC_PRER_PREDIV_S_OFFSET  (0U)
+#define RTC_PRER_PREDIV_S_MASK    (0x7FFFUL << REGISTER_FIELD_OFFSET(RTC, PRER, PREDIV_S))  /*!< Mask  0x00007FFF */
+
+/*!< Wakeup timer register */
+#define RTC_WUTR_WUT_OFFSET  (0U)
+#define RTC_WUTR_WUT_MASK    (0xFFFFUL << REGISTER_FIELD_OFFSET(RTC, WUTR, WUT))  /*!< Mask  0x0000FFFF */
+
+/*!< Write protection register */
+#define RTC_WPR_KEY_OFFSET  (0U)
+#define RTC_WPR_KEY_MASK    (0xFFUL << REGISTER_FIELD_OFFSET(RTC, WPR, KEY))  /*!< Mask  0x000000FF */
+
+// Values of write protection key
+#define RTC_WPRKEY_UNLOCK1  (0xCAUL)  /*!< Value 0x000000CA */
+#define RTC_WPRKEY_UNLOCK2  (0x53UL)  /*!< Value 0x00000053 */
+#define RTC_WPRKEY_LOCK     (0xFFUL)  /*!< Value 0x000000FF */
+
+/*!< Sub second register */
+#define RTC_SSR_SS_OFFSET  (0U)
+#define RTC_SSR_SS_MASK    (0xFFFFUL << REGISTER_FIELD_OFFSET(RTC, SSR, SS))  /*!< Mask  0x0000FFFF */
+
+/*!< RTC registers */
+#define RTC_OFFSET 0x4000UL
+#define RTC_BASE OFFSET_ADDRESS(D3_APB4_BASE, RTC_OFFSET)
+#define RTC_COMMON REGISTER_PTR(rtc_regs, RTC_BASE)
+
+/** @} */ // End of RealTimeClock group
+
+/** @} */ // End of RegisterGroup group
+
+#endif // RTC_REGISTERS_H
@@ -33,13 +33,14 @@ typedef struct {
 	RW uint32_t EXTICR3;          /*!< External interrupt configuration 3 register    (Offset 0x10)           */
 	RW uint32_t EXTICR4;          /*!< External interrupt configuration 4 register    (Offset 0x14)           */
 	RW uint32_t CFGR;             /*!< Configuration register                         (Offset 0x18)           */
-	RW uint32_t CCCR;             /*!< Compensation cell control and status register  (Offset 0x20)           */
+	   uint32_t reserved1;        /*!< Reserved                                       (Offset 0x1C)           */
+	RW uint32_t CCCSR;            /*!< Compensation cell control and status register  (Offset 0x20)           */
 	RO uint32_t CCVR;             /*!< Compensation cell value register               (Offset 0x24)           */
 	RW uint32_t CCCR;             /*!< Compensation cell code register                (Offset 0x28)           */
 	RW uint32_t PWRCR;            /*!< Power control register                         (Offset 0x2C)           */
-	   uint32_t reserved1[61U];   /*!< Reserved                                       (Offset 0x30 to 0x120)  */
+	   uint32_t reserved2[61U];   /*!< Reserved                                       (Offset 0x30 to 0x120)  */
 	RO uint32_t PKGR;             /*!< Package register                               (Offset 0x124)          */
-	   uint32_t reserved2[118U];  /*!< Reserved                                       (Offset 0x128 to 0x2FC) */
+	   uint32_t reserved3[118U];  /*!< Reserved                                       (Offset 0x128 to 0x2FC) */
 	RO uint32_t UR0;              /*!< User 0  register                               (Offset 0x300)          */
 	RW uint32_t UR1;              /*!< User 1  register                               (Offset 0x304)          */
 	RW uint32_t UR2;              /*!< User 2  register                               (Offset 0x308)          */
@@ -286,17 +287,17 @@ typedef struct {
 #define SYSCFG_M4HARDFAULT_CONNECTTOTIMER       (0x1UL)  /*!< Value 0x00000001 */
 
 /*!< Compensation cell control and status register */
-#define SYSCFG_CCCR_HSLV_OFFSET   (16U)
-#define SYSCFG_CCCR_HSLV_MASK     (0x1UL << REGISTER_FIELD_OFFSET(SYSCFG, CCCR, HSLV))   /*!< Mask  0x00010000 */
+#define SYSCFG_CCCSR_HSLV_OFFSET   (16U)
+#define SYSCFG_CCCSR_HSLV_MASK     (0x1UL << REGISTER_FIELD_OFFSET(SYSCFG, CCCSR, HSLV))   /*!< Mask  0x00010000 */
 
-#define SYSCFG_CCCR_READY_OFFSET  (8U)
-#define SYSCFG_CCCR_READY_MASK    (0x1UL << REGISTER_FIELD_OFFSET(SYSCFG, CCCR, READY))  /*!< Mask  0x00000100 */
+#define SYSCFG_CCCSR_READY_OFFSET  (8U)
+#define SYSCFG_CCCSR_READY_MASK    (0x1UL << REGISTER_FIELD_OFFSET(SYSCFG, CCCSR, READY))  /*!< Mask  0x00000100 */
 
-#define SYSCFG_CCCR_CS_OFFSET     (1U)
-#define SYSCFG_CCCR_CS_MASK       (0x1UL << REGISTER_FIELD_OFFSET(SYSCFG, CCCR, CS))     /*!< Mask  0x00000002 */
+#define SYSCFG_CCCSR_CS_OFFSET     (1U)
+#define SYSCFG_CCCSR_CS_MASK       (0x1UL << REGISTER_FIELD_OFFSET(SYSCFG, CCCSR, CS))     /*!< Mask  0x00000002 */
 
-#define SYSCFG_CCCR_EN_OFFSET     (0U)
-#define SYSCFG_CCCR_EN_MASK       (0x1UL << REGISTER_FIELD_OFFSET(SYSCFG, CCCR, EN))     /*!< Mask  0x00000001 */
+#define SYSCFG_CCCSR_EN_OFFSET     (0U)
+#define SYSCFG_CCCSR_EN_MASK       (0x1UL << REGISTER_FIELD_OFFSET(SYSCFG, CCCSR, EN))     /*!< Mask  0x00000001 */
 
 // Values of high speed at low voltage optimization enable bit
 #define SYSCFG_IOSPEEDLOWVLTOPT_DISABLE  (0x0UL)  /*!< Value 0x00000000 */
@@ -814,14 +815,10 @@ typedef struct {
 #define SYSCFG_IOVLT_FULLVLTRANGE  (0x0UL)  /*!< Value 0x00000000 */
 #define SYSCFG_IOVLT_BELOW2_7V     (0x1UL)  /*!< Value 0x00000001 */
 
-#define SYSCFG_OFFSET 0x400UL
-#define SYSCFG_BASE (D3_APB4_BASE + SYSCFG_OFFSET)
-#define SYSCFG_ADDRESS_RANGE 0x400UL
-
 /*!< SYSCFG registers */
-#define SYSCFG_OFFSET (0*SYSCFG_ADDRESS_RANGE)
-#define SYSCFG_BASE OFFSET_ADDRESS(SYSCFG_BASE, SYSCFG_OFFSET)
-#define SYSCFG REGISTER_PTR(syscfg_bank_regs, SYSCFG_BASE)
+#define SYSCFG_OFFSET 0x400UL
+#define SYSCFG_BASE OFFSET_ADDRESS(D3_APB4_BASE, SYSCFG_OFFSET)
+#define SYSCFG_COMMON REGISTER_PTR(syscfg_bank_regs, SYSCFG_BASE)
 
 /** @} */ // End of SystemConfiguration group
 
@@ -0,0 +1,151 @@
+#ifndef FLASH_WRITER_H
+#define FLASH_WRITER_H
+/**
+ * @copyright
+ * @file flash_writer.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Flash writer function signatures
+ *        Data is written to bank 2 through streams. It is accumulated into 256 bit flash words which are programmed in background and completed by FLASH_irq_handler
+ *        The log stream is appended to the upper sectors of bank 2 and the firmware update stream fills the lower ones
+ *        Bank 1 keeps executing while bank 2 is erased or programmed
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ *  @defgroup FlashWriterGroup Flash writer macros, structure and functions
+ *  @brief Flash writer macros, structure and functions
+ *  @{
+ */
+
+/*!< Size of a flash word in bytes. It is the smallest amount of data the flash can program */
+#define FLASH_WRITER_WORD_SIZE 32U
+
+/*!< Number of flash words waiting to be programmed */
+#define FLASH_WRITER_QUEUE_WORDS 16U
+
+/*!< Base address of bank 2 */
+#define FLASH_WRITER_BANK2_BASE 0x08100000UL
+
+/*!< Size of a sector in bytes */
+#define FLASH_WRITER_SECTOR_SIZE 0x20000UL
+
+/*!< First sector of bank 2 used by the log. Lower sectors receive firmware updates */
+#define FLASH_WRITER_FIRST_SECTOR 4U
+
+/*!< Number of sectors used by the log */
+#define FLASH_WRITER_SECTORS 4U
+
+/*!< Address range of the log */
+#define FLASH_WRITER_START (FLASH_WRITER_BANK2_BASE + (FLASH_WRITER_FIRST_SECTOR * FLASH_WRITER_SECTOR_SIZE))
+#define FLASH_WRITER_END (FLASH_WRITER_START + (FLASH_WRITER_SECTORS * FLASH_WRITER_SECTOR_SIZE))
+
+/**
+ * @brief Flash writer streams
+ *        Streams share the queue hence flash words are programmed in the order they are written regardless of the stream
+ */
+typedef enum {
+	FLASH_WRITER_STREAM_LOG,      /*!< Log. It wraps around to the first sector when it reaches the end of the last one */
+	FLASH_WRITER_STREAM_UPDATE,   /*!< Firmware update. It stops at the end of the address range it has been opened with */
+	FLASH_WRITER_STREAM_NUMBER    /*!< Number of streams */
+} flash_writer_stream;
+
+/**
+ * @brief Flash writer statistics
+ */
+typedef struct {
+	uint32_t words;    /*!< Flash words programmed */
+	uint32_t erases;   /*!< Sectors erased */
+	uint32_t errors;   /*!< Operations that failed. The flash word or the sector is skipped */
+	uint32_t drops;    /*!< Bytes dropped because the queue was full or the address range is full */
+} flash_writer_stats;
+
+/**
+ * @brief Function: flash_writer_init
+ *
+ * Unlock bank 2, enable its interrupts and look for the end of the log. Writing resumes at the first erased flash word
+ */
+void flash_writer_init(void);
+
+/**
+ * @brief Function: flash_writer_open
+ *
+ * \param stream: stream that does not wrap around
+ * \param start: address of the first byte. It must be the start of a sector
+ * \param end: address following the last byte. It must be the end of a sector
+ * \return true if the stream has been opened, false if the stream wraps around or it still has data to program
+ *
+ * Restart the stream at the beginning of the address range and clear its statistics
+ */
+bool flash_writer_open(flash_writer_stream stream, uint32_t start, uint32_t end);
+
+/**
+ * @brief Function: flash_writer_write
+ *
+ * \param stream: stream to write to
+ * \param data: data to append to the stream
+ * \param size: size of the data in bytes
+ * \return number of bytes accepted
+ *
+ * It never waits for the flash. The byte completing a flash word is dropped with the ones following it when the queue is full
+ * Each sector is erased before its first flash word is programmed
+ */
+uint32_t flash_writer_write(flash_writer_stream stream, const void * data, uint32_t size);
+
+/**
+ * @brief Function: flash_writer_flush
+ *
+ * \param stream: stream to flush
+ * \return true if the partial flash word has been queued or there was none, false if the queue is full
+ *
+ * Pad the partial flash word with erased bytes (0xFF) and queue it
+ */
+bool flash_writer_flush(flash_writer_stream stream);
+
+/**
+ * @brief Function: flash_writer_discard
+ *
+ * \param stream: stream whose partial flash word is dropped
+ *
+ * Drop the partial flash word without programming it. Its bytes can be accepted again by a stream that does not wrap around
+ */
+void flash_writer_discard(flash_writer_stream stream);
+
+/**
+ * @brief Function: flash_writer_hold
+ *
+ * \param hold: true to stop starting operations on bank 2, false to resume them
+ *
+ * Bytes are still accepted and queued while bank 2 is held. The operation ongoing when bank 2 is held runs to completion
+ * flash_writer_is_busy keeps returning true while flash words are queued hence bank 2 must not be held while waiting for it
+ */
+void flash_writer_hold(bool hold);
+
+/**
+ * @brief Function: flash_writer_is_busy
+ *
+ * \return true if an erase or a program operation is ongoing or flash words are waiting to be programmed
+ */
+bool flash_writer_is_busy(void);
+
+/**
+ * @brief Function: flash_writer_is_pending
+ *
+ * \param stream: stream
+ * \return true if flash words of the stream are waiting to be programmed or are being programmed
+ */
+bool flash_writer_is_pending(flash_writer_stream stream);
+
+/**
+ * @brief Function: flash_writer_get_stats
+ *
+ * \param stream: stream
+ * \return statistics of the stream since it has been opened
+ */
+const flash_writer_stats * flash_writer_get_stats(flash_writer_stream stream);
+
+/** @} */ // End of FlashWriterGroup group
+
+#endif // FLASH_WRITER_H
@@ -0,0 +1,51 @@
+#ifndef CYCLE_COUNTER_H
+#define CYCLE_COUNTER_H
+/**
+ * @copyright
+ * @file cycle_counter.h
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Cycle counter function signatures
+ *        The data watchpoint and trace (DWT) cycle counter counts core clock cycles
+ */
+
+#include <stdint.h>
+
+/**
+ *  @defgroup CycleCounterGroup Cycle counter macros, structure and functions
+ *  @brief Cycle counter macros, structure and functions
+ *  @{
+ */
+
+/**
+ * @brief Function: cycleCounterInit
+ *
+ * Enable trace, unlock the data watchpoint and trace (DWT) unit and start the cycle counter from 0
+ * It is called by the reset handler right after the stack pointer is set and before the data and uninitialized data sections are initialized hence it must not rely on global variables
+ * Its name follows the one of the other functions called by the reset handler (e.g. systemInit) rather than the one of the functions called from C code
+ */
+void cycleCounterInit(void);
+
+/**
+ * @brief Function: cycle_counter_get
+ *
+ * \return current value of the cycle counter
+ *
+ * Return the number of core clock cycles elapsed since the cycle counter was started
+ */
+uint32_t cycle_counter_get(void);
+
+/**
+ * @brief Function: cycle_counter_elapsed
+ *
+ * \param start: value of the cycle counter at the beginning of the measurement
+ *
+ * \return number of cycles elapsed since start
+ *
+ * The subtraction is done on unsigned 32 bit integers hence a single wrap around of the counter is handled
+ */
+uint32_t cycle_counter_elapsed(uint32_t start);
+
+/** @} */ // End of CycleCounterGroup group
+
+#endif // CYCLE_COUNTER_H
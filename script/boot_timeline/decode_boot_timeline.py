@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""
+Decode a memory dump of the boot timeline ring stored in the backup SRAM.
+
+The dump is created by running gdb with command file script/gdb/boot_timeline.gdb:
+	make gdb GDBCOMMANDFILE=boot_timeline.gdb
+Layout must be kept in sync with include/boot/boot_timeline.h
+"""
+
+import argparse
+import struct
+import sys
+
+BOOT_TIMELINE_MAGIC = 0x424F4F54
+
+PHASES = ["reset", "systemInit entry", "systemInit exit", "data copied", "bss filled", "main entry"]
+
+HEADER_FORMAT = "<3I"
+ENTRY_FORMAT = "<2I" + str(len(PHASES)) + "I"
+
+# Bits of the RCC reset status register (RSR)
+RESET_CAUSES = [
+	(31, "LPWR2"),
+	(30, "LPWR1"),
+	(29, "WWDG2"),
+	(28, "WWDG1"),
+	(27, "IWDG2"),
+	(26, "IWDG1"),
+	(25, "SFT2"),
+	(24, "SFT1"),
+	(23, "POR"),
+	(22, "PIN"),
+	(21, "BOR"),
+	(20, "D2"),
+	(19, "D1"),
+	(18, "C2"),
+	(17, "C1"),
+]
+
+def decode_reset_cause(rsr):
+	causes = [name for (bit, name) in RESET_CAUSES if (rsr >> bit) & 0x1]
+	return "|".join(causes) if causes else "-"
+
+def decode(data):
+	header_size = struct.calcsize(HEADER_FORMAT)
+	entry_size = struct.calcsize(ENTRY_FORMAT)
+
+	if len(data) < header_size:
+		raise ValueError("dump is too short to contain the ring header")
+
+	(magic, head, sequence) = struct.unpack_from(HEADER_FORMAT, data, 0)
+	if magic != BOOT_TIMELINE_MAGIC:
+		raise ValueError("invalid magic word 0x{:08X}".format(magic))
+
+	depth = (len(data) - header_size) // entry_size
+	entries = []
+	for index in range(depth):
+		fields = struct.unpack_from(ENTRY_FORMAT, data, header_size + index * entry_size)
+		# Entries never written or whose write has been interrupted by a reset have sequence set to 0
+		if fields[0] != 0:
+			entries.append((fields[0], fields[1], fields[2:]))
+
+	return sorted(entries)
+
+def print_table(entries, frequency):
+	columns = ["boot", "reset cause"] + PHASES
+	print(" | ".join(columns))
+	for (sequence, rsr, stamps) in entries:
+		# Duration of each phase is the difference with the previous stamp
+		durations = [stamps[0]] + [(stamps[i] - stamps[i - 1]) & 0xFFFFFFFF for i in range(1, len(stamps))]
+		if frequency:
+			cells = ["{:.1f}us".format(duration * 1e6 / frequency) for duration in durations]
+		else:
+			cells = [str(duration) for duration in durations]
+		print(" | ".join([str(sequence), decode_reset_cause(rsr)] + cells))
+
+def main():
+	parser = argparse.ArgumentParser(description="Decode the boot timeline ring dumped from the backup SRAM")
+	parser.add_argument("dump", help="binary dump of variable boot_timeline")
+	parser.add_argument("--frequency", type=float, default=0, help="core clock frequency in Hz to convert cycles to microseconds")
+	args = parser.parse_args()
+
+	with open(args.dump, "rb") as dump:
+		data = dump.read()
+
+	try:
+		entries = decode(data)
+	except ValueError as error:
+		sys.exit("Error: " + str(error))
+
+	print_table(entries, args.frequency)
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+"""
+Make a delta patch that rebuilds a new firmware image from the image running on the board.
+
+Both images are binaries created by make compile (objcopy of the elf file patched by script/image_crc/patch_image_crc.py)
+hence each of them ends with its checksum. The patch is applied by include/boot/firmware_delta.h while it is received.
+Format must be kept in sync with include/boot/firmware_delta.h
+"""
+
+import argparse
+import struct
+import sys
+
+FIRMWARE_DELTA_MAGIC = 0x50445357
+HEADER_FORMAT = "<3I"
+
+OPCODE_COPY = 0x00
+OPCODE_LITERAL = 0x01
+OPCODE_FILL = 0x02
+
+# Largest new image. Upper sectors of bank 2 hold the log
+FIRMWARE_UPDATE_SIZE_MAX = 4 * 0x20000
+
+# Matches are looked up by blocks of the running image aligned on 32-bit words
+BLOCK_SIZE = 16
+BLOCK_ALIGN = 4
+CANDIDATES_MAX = 8
+
+# Shortest runs worth a command instead of literal bytes
+COPY_MIN = BLOCK_SIZE
+FILL_MIN = 8
+
+def number(value):
+	# Unsigned LEB128
+	encoded = bytearray()
+	while True:
+		byte = value & 0x7F
+		value >>= 7
+		if value != 0:
+			encoded.append(byte | 0x80)
+		else:
+			encoded.append(byte)
+			return encoded
+
+def index_blocks(source):
+	blocks = {}
+	for offset in range(0, len(source) - BLOCK_SIZE + 1, BLOCK_ALIGN):
+		candidates = blocks.setdefault(bytes(source[offset:offset + BLOCK_SIZE]), [])
+		if len(candidates) < CANDIDATES_MAX:
+			candidates.append(offset)
+	return blocks
+
+def match_length(source, source_offset, target, target_offset):
+	length = 0
+	limit = min(len(source) - source_offset, len(target) - target_offset)
+	while (length < limit) and (source[source_offset + length] == target[target_offset + length]):
+		length += 1
+	return length
+
+def run_length(target, offset):
+	length = 1
+	while (offset + length < len(target)) and (target[offset + length] == target[offset]):
+		length += 1
+	return length
+
+def make_delta(source, target):
+	blocks = index_blocks(source)
+	commands = bytearray()
+	literal = bytearray()
+	# Code that did not change is usually found right after the previous match
+	next_source = 0
+
+	def flush_literal():
+		if literal:
+			commands.append(OPCODE_LITERAL)
+			commands.extend(number(len(literal)))
+			commands.extend(literal)
+			literal.clear()
+
+	offset = 0
+	while offset < len(target):
+		best_source = None
+		best_length = 0
+		candidates = list(blocks.get(bytes(target[offset:offset + BLOCK_SIZE]), []))
+		if next_source < len(source):
+			candidates.insert(0, next_source)
+		for candidate in candidates:
+			length = match_length(source, candidate, target, offset)
+			if length > best_length:
+				(best_source, best_length) = (candidate, length)
+
+		fill_length = run_length(target, offset)
+
+		if (fill_length >= FILL_MIN) and (fill_length >= best_length):
+			flush_literal()
+			commands.append(OPCODE_FILL)
+			commands.append(target[offset])
+			commands.extend(number(fill_length))
+			offset += fill_length
+		elif best_length >= COPY_MIN:
+			flush_literal()
+			commands.append(OPCODE_COPY)
+			commands.extend(number(best_source))
+			commands.extend(number(best_length))
+			offset += best_length
+			next_source = best_source + best_length
+		else:
+			literal.append(target[offset])
+			offset += 1
+			next_source += 1
+
+	flush_literal()
+
+	base_crc = struct.unpack_from("<I", source, len(source) - 4)[0]
+	return struct.pack(HEADER_FORMAT, FIRMWARE_DELTA_MAGIC, base_crc, len(target)) + commands
+
+def read_number(patch, offset):
+	value = 0
+	shift = 0
+	while True:
+		byte = patch[offset]
+		offset += 1
+		value |= (byte & 0x7F) << shift
+		shift += 7
+		if (byte & 0x80) == 0:
+			return (value, offset)
+
+def apply_delta(source, patch):
+	(magic, base_crc, size) = struct.unpack_from(HEADER_FORMAT, patch, 0)
+	offset = struct.calcsize(HEADER_FORMAT)
+	target = bytearray()
+	while len(target) < size:
+		opcode = patch[offset]
+		offset += 1
+		if opcode == OPCODE_COPY:
+			(source_offset, offset) = read_number(patch, offset)
+			(length, offset) = read_number(patch, offset)
+			target.extend(source[source_offset:source_offset + length])
+		elif opcode == OPCODE_LITERAL:
+			(length, offset) = read_number(patch, offset)
+			target.extend(patch[offset:offset + length])
+			offset += length
+		elif opcode == OPCODE_FILL:
+			value = patch[offset]
+			(length, offset) = read_number(patch, offset + 1)
+			target.extend(bytes([value]) * length)
+		else:
+			raise ValueError("unknown opcode 0x{:02X}".format(opcode))
+	return target
+
+def main():
+	parser = argparse.ArgumentParser(description="Make a delta patch from the running firmware image to a new one")
+	parser.add_argument("base", help="binary of the image running on the board")
+	parser.add_argument("image", help="binary of the new image")
+	parser.add_argument("--output", required=True, help="patch file to write")
+	args = parser.parse_args()
+
+	with open(args.base, "rb") as base_file:
+		source = base_file.read()
+	with open(args.image, "rb") as image_file:
+		target = image_file.read()
+
+	if (len(source) < 8) or (len(target) < 8) or (len(source) % 4 != 0) or (len(target) % 4 != 0):
+		sys.exit("Error: images must be made of 32-bit words and end with their checksum")
+	if len(target) > FIRMWARE_UPDATE_SIZE_MAX:
+		sys.exit("Error: new image is {} bytes long and it must fit {} bytes".format(len(target), FIRMWARE_UPDATE_SIZE_MAX))
+
+	patch = make_delta(source, target)
+
+	# Decode the patch the same way the board does so that a broken patch is never sent
+	if apply_delta(source, patch) != target:
+		sys.exit("Error: patch does not rebuild the new image")
+
+	with open(args.output, "wb") as patch_file:
+		patch_file.write(patch)
+
+	print("Patch {} bytes for image {} bytes ({:.1f}%)".format(len(patch), len(target), (100.0 * len(patch)) / len(target)))
+
+if __name__ == "__main__":
+	main()
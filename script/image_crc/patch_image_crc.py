@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""
+Compute the checksum of the firmware image and store it into section .image_crc of the elf file.
+
+The checksum is computed the same way as the CRC unit of the flash interface:
+- polynomial 0x04C11DB7, initial value 0xFFFFFFFF, no reflection and no final XOR
+- data is read as 32-bit little endian words and each word is fed most significant bit first
+It covers flash memory from the start of the image to symbol _eimage. Gaps between sections are erased flash words (0xFF).
+Layout must be kept in sync with script/linker/CortexM7.ld and include/boot/image_crc.h
+"""
+
+import argparse
+import struct
+import sys
+
+CRC_POLYNOMIAL = 0x04C11DB7
+CRC_INIT = 0xFFFFFFFF
+
+FLASH_START = 0x08000000
+FLASH_ERASED_BYTE = 0xFF
+
+IMAGE_CRC_SECTION = ".image_crc"
+IMAGE_END_SYMBOL = "_eimage"
+
+# ELF constants
+ELF_MAGIC = b"\x7fELF"
+ELFCLASS32 = 1
+ELFDATA2LSB = 1
+PT_LOAD = 1
+SHT_SYMTAB = 2
+
+def crc32_word(crc, word):
+	crc ^= word
+	for _ in range(32):
+		if crc & 0x80000000:
+			crc = ((crc << 1) ^ CRC_POLYNOMIAL) & 0xFFFFFFFF
+		else:
+			crc = (crc << 1) & 0xFFFFFFFF
+	return crc
+
+def crc32(data):
+	crc = CRC_INIT
+	for (word,) in struct.iter_unpack("<I", data):
+		crc = crc32_word(crc, word)
+	return crc
+
+class Elf:
+	def __init__(self, data):
+		if data[0:4] != ELF_MAGIC or data[4] != ELFCLASS32 or data[5] != ELFDATA2LSB:
+			raise ValueError("not a 32-bit little endian elf file")
+		self.data = data
+		(self.phoff, self.shoff) = struct.unpack_from("<II", data, 0x1C)
+		(self.phentsize, self.phnum, self.shentsize, self.shnum, self.shstrndx) = struct.unpack_from("<5H", data, 0x2A)
+
+	def segments(self):
+		for index in range(self.phnum):
+			yield struct.unpack_from("<8I", self.data, self.phoff + index * self.phentsize)
+
+	def sections(self):
+		for index in range(self.shnum):
+			yield struct.unpack_from("<10I", self.data, self.shoff + index * self.shentsize)
+
+	def string(self, table_offset, offset):
+		end = self.data.index(b"\0", table_offset + offset)
+		return self.data[table_offset + offset:end].decode()
+
+	def section(self, name):
+		names_offset = list(self.sections())[self.shstrndx][4]
+		for section in self.sections():
+			if self.string(names_offset, section[0]) == name:
+				return section
+		raise ValueError("section " + name + " not found")
+
+	def symbol(self, name):
+		sections = list(self.sections())
+		for section in sections:
+			if section[1] == SHT_SYMTAB:
+				names_offset = sections[section[6]][4]
+				for offset in range(section[4], section[4] + section[5], section[9]):
+					(sym_name, value) = struct.unpack_from("<II", self.data, offset)
+					if self.string(names_offset, sym_name) == name:
+						return value
+		raise ValueError("symbol " + name + " not found")
+
+	def flash_image(self, end):
+		# Rebuild the content of the flash memory from the load address of every segment
+		image = bytearray([FLASH_ERASED_BYTE] * (end - FLASH_START))
+		for (p_type, p_offset, p_vaddr, p_paddr, p_filesz, p_memsz, p_flags, p_align) in self.segments():
+			if (p_type == PT_LOAD) and (p_filesz != 0) and (p_paddr >= FLASH_START) and (p_paddr < end):
+				size = min(p_filesz, end - p_paddr)
+				image[p_paddr - FLASH_START:p_paddr - FLASH_START + size] = self.data[p_offset:p_offset + size]
+		return image
+
+def main():
+	parser = argparse.ArgumentParser(description="Store the checksum of the firmware image into the elf file")
+	parser.add_argument("elf", help="elf file to patch")
+	args = parser.parse_args()
+
+	with open(args.elf, "rb") as elf_file:
+		data = bytearray(elf_file.read())
+
+	try:
+		elf = Elf(data)
+		image_end = elf.symbol(IMAGE_END_SYMBOL)
+		crc_section = elf.section(IMAGE_CRC_SECTION)
+	except ValueError as error:
+		sys.exit("Error: " + str(error))
+
+	# Checksum is the word stored at the end of the image
+	crc_offset = crc_section[4] + image_end - crc_section[3]
+	crc = crc32(elf.flash_image(image_end))
+	struct.pack_into("<I", data, crc_offset, crc)
+
+	with open(args.elf, "wb") as elf_file:
+		elf_file.write(data)
+
+	print("Image 0x{:08X}-0x{:08X} checksum 0x{:08X}".format(FLASH_START, image_end, crc))
+
+if __name__ == "__main__":
+	main()
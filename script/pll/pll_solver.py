@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""
+Compute the dividers of PLL1, PLL2 and PLL3 for a set of target output frequencies and write them to a C header.
+
+Each PLL is given as P,Q,R frequencies in Hz. The generated header is included by include/boot/pll.h which
+checks at compile time that reference clock and VCO frequencies are within range.
+Ranges must be kept in sync with include/boot/pll.h
+"""
+
+import argparse
+import sys
+
+SOURCES = {
+	"HSI": ("RCC_PLLSRC_HSI", 64000000),
+	"CSI": ("RCC_PLLSRC_CSI", 4000000),
+	"HSE": ("RCC_PLLSRC_HSE", None),
+}
+
+DIVM_MAX = 63
+DIVN_MIN = 4
+DIVN_MAX = 512
+DIV_OUTPUT_MAX = 128
+FRACN_STEPS = 8192
+
+REF_MIN = 1000000
+REF_MAX = 16000000
+
+# (name, minimum reference clock, minimum VCO frequency, maximum VCO frequency)
+VCO_RANGES = [
+	("RCC_PLLVCOSEL_WIDE", 2000000, 192000000, 960000000),
+	("RCC_PLLVCOSEL_MEDIUM", REF_MIN, 150000000, 420000000),
+]
+
+# Reference clock ranges: 1-2 MHz, 2-4 MHz, 4-8 MHz and 8-16 MHz
+RANGES = ["RCC_PLLFREQRANGE_1_2MHZ", "RCC_PLLFREQRANGE_2_4MHZ", "RCC_PLLFREQRANGE_4_8MHZ", "RCC_PLLFREQRANGE_8_16MHZ"]
+
+class Solution:
+	def __init__(self, divm, ref, vco, divn, fracn, divp, divq, divr, vcosel):
+		self.divm = divm
+		self.ref = ref
+		self.vco = vco
+		self.divn = divn
+		self.fracn = fracn
+		self.divp = divp
+		self.divq = divq
+		self.divr = divr
+		self.vcosel = vcosel
+
+	def output(self, div):
+		return self.vco / div
+
+	def rge(self):
+		for (index, name) in enumerate(RANGES):
+			if self.ref <= (REF_MIN * 2) << index:
+				return name
+		raise ValueError("reference clock out of range")
+
+def closest_divider(vco, target):
+	div = min(max(int(round(vco / target)), 1), DIV_OUTPUT_MAX)
+	return div
+
+def solve(input_freq, targets, even_divp):
+	(p_target, q_target, r_target) = targets
+	best = None
+	best_key = None
+	for divm in range(1, DIVM_MAX + 1):
+		ref = input_freq / divm
+		if (ref < REF_MIN) or (ref > REF_MAX):
+			continue
+		for divp in range(1, DIV_OUTPUT_MAX + 1):
+			if even_divp and (divp % 2 != 0):
+				continue
+			vco_target = p_target * divp
+			for (vcosel, ref_min, vco_min, vco_max) in VCO_RANGES:
+				if (ref < ref_min) or (vco_target < vco_min) or (vco_target > vco_max):
+					continue
+				multiplier = vco_target / ref
+				divn = int(multiplier)
+				fracn = int(round((multiplier - divn) * FRACN_STEPS))
+				if fracn == FRACN_STEPS:
+					(divn, fracn) = (divn + 1, 0)
+				if (divn < DIVN_MIN) or (divn > DIVN_MAX):
+					continue
+				vco = ref * (divn + fracn / FRACN_STEPS)
+				divq = closest_divider(vco, q_target)
+				divr = closest_divider(vco, r_target)
+				solution = Solution(divm, ref, vco, divn, fracn, divp, divq, divr, vcosel)
+				error = abs(solution.output(divp) - p_target)
+				output_error = abs(solution.output(divq) - q_target) + abs(solution.output(divr) - r_target)
+				# Exact P output first, then integer multiplier, exact Q and R outputs and highest reference clock for lowest jitter
+				key = (round(error), fracn != 0, round(output_error), -ref, vco)
+				if (best_key is None) or (key < best_key):
+					(best, best_key) = (solution, key)
+				break
+	if best is None:
+		raise ValueError("no divider combination reaches {} Hz".format(p_target))
+	return best
+
+def parse_targets(text):
+	values = [int(float(value)) for value in text.split(",")]
+	if (len(values) == 0) or (len(values) > 3):
+		raise argparse.ArgumentTypeError("expected P[,Q[,R]] frequencies in Hz")
+	# Missing outputs run at the frequency of P
+	while len(values) < 3:
+		values.append(values[0])
+	return tuple(values)
+
+def parse_plls(text):
+	plls = [int(value) for value in text.split(",")]
+	if any((pll < 1) or (pll > 3) for pll in plls):
+		raise argparse.ArgumentTypeError("expected PLL numbers between 1 and 3")
+	return plls
+
+def header(args, source, input_freq, solutions):
+	guard = "PLL_CONFIG_" + args.name.upper() + "_H"
+	lines = [
+		"#ifndef " + guard,
+		"#define " + guard,
+		"/**",
+		" * @copyright",
+		" * @file pll_config_" + args.name + ".h",
+		" * @author Andrea Gianarda",
+		" * @date 17th of October 2026",
+		" * @brief PLL dividers of clock profile " + args.name,
+		" *        Generated by script/pll/pll_solver.py: " + " ".join(sys.argv[1:]),
+		" *        Do not edit by hand",
+		" */",
+		"",
+		"/*!< PLL source clock */",
+		"#define PLL_SOURCE " + source,
+		"",
+		"/*!< Frequency of the PLL source clock in Hz */",
+		"#define PLL_INPUT_FREQ {}UL".format(input_freq),
+	]
+	for (index, solution) in enumerate(solutions):
+		pll = "PLL{}".format(index + 1)
+		lines += [
+			"",
+			"/*!< {}: reference clock {:.0f} Hz, VCO {:.0f} Hz, outputs P {:.0f} Hz, Q {:.0f} Hz, R {:.0f} Hz */".format(
+				pll, solution.ref, solution.vco, solution.output(solution.divp), solution.output(solution.divq), solution.output(solution.divr)),
+			"#define {}_DIVM {}UL".format(pll, solution.divm),
+			"#define {}_DIVN {}UL".format(pll, solution.divn),
+			"#define {}_FRACN {}UL".format(pll, solution.fracn),
+			"#define {}_DIVP {}UL".format(pll, solution.divp),
+			"#define {}_DIVQ {}UL".format(pll, solution.divq),
+			"#define {}_DIVR {}UL".format(pll, solution.divr),
+			"#define {}_RGE {}".format(pll, solution.rge()),
+			"#define {}_VCOSEL {}".format(pll, solution.vcosel),
+			"#define {}_FRACEN {}".format(pll, "RCC_PLLFRAC_ENABLE" if (solution.fracn != 0) or ((index + 1) in args.fractional) else "RCC_PLLFRAC_DISABLE"),
+		]
+	lines += ["", "#endif // " + guard, ""]
+	return "\n".join(lines)
+
+def main():
+	parser = argparse.ArgumentParser(description="Compute PLL dividers and write them to a C header")
+	parser.add_argument("name", help="name of the configuration")
+	parser.add_argument("--source", choices=SOURCES.keys(), default="HSI", help="PLL source clock")
+	parser.add_argument("--input-freq", type=int, help="frequency of the PLL source clock in Hz (required for HSE)")
+	parser.add_argument("--pll1", type=parse_targets, required=True, help="P[,Q[,R]] output frequencies of PLL1 in Hz")
+	parser.add_argument("--pll2", type=parse_targets, required=True, help="P[,Q[,R]] output frequencies of PLL2 in Hz")
+	parser.add_argument("--pll3", type=parse_targets, required=True, help="P[,Q[,R]] output frequencies of PLL3 in Hz")
+	parser.add_argument("--fractional", type=parse_plls, default=[], help="comma separated PLL numbers kept in fractional mode so that they can be trimmed at runtime")
+	parser.add_argument("--output", required=True, help="header file to write")
+	args = parser.parse_args()
+
+	(source, input_freq) = SOURCES[args.source]
+	if args.input_freq is not None:
+		input_freq = args.input_freq
+	if input_freq is None:
+		sys.exit("Error: the frequency of " + args.source + " must be given with --input-freq")
+
+	try:
+		# Odd values of the P divider of PLL1 are not allowed
+		solutions = [
+			solve(input_freq, args.pll1, True),
+			solve(input_freq, args.pll2, False),
+			solve(input_freq, args.pll3, False),
+		]
+	except ValueError as error:
+		sys.exit("Error: " + str(error))
+
+	with open(args.output, "w") as output:
+		output.write(header(args, source, input_freq, solutions))
+
+if __name__ == "__main__":
+	main()
@@ -8,31 +8,67 @@
 
 #include "registers/peripheral/rcc.h"
 #include "registers/peripheral/flash.h"
+#include "registers/peripheral/power.h"
+#include "registers/peripheral/syscfg.h"
+#include "boot/boot.h"
+#include "boot/sections.h"
+#include "boot/boot_timeline.h"
+#include "boot/warm_boot.h"
+#include "boot/image_crc.h"
+#include "clock/dvfs.h"
+#include "utility/cycle_counter.h"
 
-void systemInit(void) {
+uint32_t boot_cycles NOINIT;
+boot_phase_times boot_phase NOINIT;
 
-	// Reset value of flash read latency is 7, hence start the procedure to increase the clock frequency if too low
-	if (GET_FIELD_VALUE(FLASH_BANK1->ACR, FLASH, ACR, LATENCY) < FLASH_LATENCY_7WAITSTATE) {
-		MODIFY_FIELD(FLASH_BANK1->ACR, FLASH, ACR, LATENCY, FLASH_LATENCY_7WAITSTATE);
-	}
+#ifdef SUPPLY_LDO
+// Core is supplied by the LDO regulator: VOS0 is reached by enabling the overdrive on top of VOS1
+#define BOOT_SUPPLY_STEPDOWN PWR_STEPDOWNCONV_DISABLE
+#define BOOT_SUPPLY_LDO PWR_LOWDROPOUTREG_ENABLE
+#define BOOT_OVERDRIVE SYSCFG_PWROVDR_ENABLE
+#define BOOT_VOLTAGE_SCALE DVFS_VOS0
+#else
+// Core is supplied directly by the SMPS step down converter: VOS1 is the highest voltage scaling
+#define BOOT_SUPPLY_STEPDOWN PWR_STEPDOWNCONV_ENABLE
+#define BOOT_SUPPLY_LDO PWR_LOWDROPOUTREG_DISABLE
+#define BOOT_OVERDRIVE SYSCFG_PWROVDR_DISABLE
+#define BOOT_VOLTAGE_SCALE DVFS_VOS1
+#endif // SUPPLY_LDO
 
-	// Enable HSI only
-	//MODIFY_REG(RCC_COMMON->CR, REGISTER_FIELD_SETTER(RCC, CR, HSION, RCC_CR_HSIEN_ENABLE))
-	MODIFY_FIELD(RCC_COMMON->CR, RCC, CR, HSION, RCC_CLK_ENABLE);
+static void system_voltage_scaling_start(void) {
 
-	CLEAR_BITS(RCC_COMMON->CR, (
-		REGISTER_FIELD_SETTER(RCC, CR, HSION,    RCC_CLK_DISABLE    ) |
-		REGISTER_FIELD_SETTER(RCC, CR, HSIDIV,   RCC_HSIDIV_UPDATED ) |
-		REGISTER_FIELD_SETTER(RCC, CR, CSION,    RCC_CLK_DISABLE    ) |
-		REGISTER_FIELD_SETTER(RCC, CR, CSISMON,  RCC_CLK_DISABLE    ) |
-		REGISTER_FIELD_SETTER(RCC, CR, HSI48ON,  RCC_CLK_DISABLE    ) |
-		REGISTER_FIELD_SETTER(RCC, CR, HSEON,    RCC_CLK_DISABLE    ) |
-		REGISTER_FIELD_SETTER(RCC, CR, HSEBYP,   RCC_HSE_NOBYPASS   ) |
-		REGISTER_FIELD_SETTER(RCC, CR, HSECSSON, RCC_CLK_DISABLE    ) |
-		REGISTER_FIELD_SETTER(RCC, CR, PLL1ON,   RCC_PLL_DISABLE    ) |
-		REGISTER_FIELD_SETTER(RCC, CR, PLL2ON,   RCC_PLL_DISABLE    ) |
-		REGISTER_FIELD_SETTER(RCC, CR, PLL3ON,   RCC_PLL_DISABLE    ) )
+	// Supply configuration can be written only once after a power on reset hence all its fields are written at once
+	MODIFY_FIELD_WITH_MASK(PWR_COMMON->CR3, (PWR_CR3_SDEN_MASK | PWR_CR3_LDOEN_MASK | PWR_CR3_BYPASS_MASK), (
+		REGISTER_FIELD_SETTER(PWR, CR3, SDEN,   BOOT_SUPPLY_STEPDOWN      ) |
+		REGISTER_FIELD_SETTER(PWR, CR3, LDOEN,  BOOT_SUPPLY_LDO           ) |
+		REGISTER_FIELD_SETTER(PWR, CR3, BYPASS, PWR_PWRMGMTBYPASS_DISABLE ) )
 	);
+	while (GET_FIELD_VALUE(PWR_COMMON->CSR1, PWR, CSR1, ACTVOSRDY) != PWR_ACTIVEVOS_READY) {
+	}
+
+	// Core voltage rises while PLLs lock and memory is initialized. The overdrive is enabled by systemClockSwitch once VOS1 is reached
+	MODIFY_FIELD(PWR_COMMON->D3CR, PWR, D3CR, VOS, PWR_D3VOS_SCALE1);
+
+	// System configuration controller holds the overdrive enable
+	MODIFY_FIELD(RCC_COMMON->APB4ENR, RCC, APB4ENR, SYSCFGEN, RCC_PERIPHERALCLK_ENABLE);
+
+}
+
+static void system_voltage_scaling_wait(void) {
+
+	while (GET_FIELD_VALUE(PWR_COMMON->D3CR, PWR, D3CR, VOSRDY) != PWR_D3VOS_READY) {
+	}
+
+	if (BOOT_OVERDRIVE == SYSCFG_PWROVDR_ENABLE) {
+		// VOS0 is entered from VOS1 only
+		MODIFY_FIELD(SYSCFG_COMMON->PWRCR, SYSCFG, PWRCR, ODEN, SYSCFG_PWROVDR_ENABLE);
+		while (GET_FIELD_VALUE(PWR_COMMON->D3CR, PWR, D3CR, VOSRDY) != PWR_D3VOS_READY) {
+		}
+	}
+
+}
+
+static void system_clock_default_config(void) {
 
 	// Clock configuration
 	MODIFY_REG(RCC_COMMON->CFGR, (
@@ -76,71 +112,72 @@ void systemInit(void) {
 
 	// PLL clock selection
 	MODIFY_REG(RCC_COMMON->PLLCKSELR, (
-		REGISTER_FIELD_SETTER(RCC, PLLCKSELR, DIVM3,  RCC_PLLPRE_DIV32 ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCKSELR, DIVM2,  RCC_PLLPRE_DIV32 ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCKSELR, DIVM1,  RCC_PLLPRE_DIV32 ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCKSELR, PLLSRC, RCC_PLLSRC_HSI   ) )
+		REGISTER_FIELD_SETTER(RCC, PLLCKSELR, DIVM3,  PLL3_DIVM  ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCKSELR, DIVM2,  PLL2_DIVM  ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCKSELR, DIVM1,  PLL1_DIVM  ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCKSELR, PLLSRC, PLL_SOURCE ) )
 	);
 
 	// PLL configuration
 	MODIFY_REG(RCC_COMMON->PLLCFGR, (
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVR3EN,    RCC_PLLDIVR_ENABLE      ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVQ3EN,    RCC_PLLDIVQ_ENABLE      ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVP3EN,    RCC_PLLDIVP_ENABLE      ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVR2EN,    RCC_PLLDIVR_ENABLE      ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVQ2EN,    RCC_PLLDIVQ_ENABLE      ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVP2EN,    RCC_PLLDIVP_ENABLE      ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVR1EN,    RCC_PLLDIVR_ENABLE      ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVQ1EN,    RCC_PLLDIVQ_ENABLE      ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVP1EN,    RCC_PLLDIVP_ENABLE      ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL3RGE,    RCC_PLLFREQRANGE_1_2MHZ ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL3VCOSEL, RCC_PLLVCOSEL_WIDE      ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL3FRACEN, RCC_PLLFRAC_DISABLE     ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL2RGE,    RCC_PLLFREQRANGE_1_2MHZ ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL2VCOSEL, RCC_PLLVCOSEL_WIDE      ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL2FRACEN, RCC_PLLFRAC_DISABLE     ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL1RGE,    RCC_PLLFREQRANGE_1_2MHZ ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL1VCOSEL, RCC_PLLVCOSEL_WIDE      ) |
-		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL1FRACEN, RCC_PLLFRAC_DISABLE     ) )
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVR3EN,    RCC_PLLDIVR_ENABLE ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVQ3EN,    RCC_PLLDIVQ_ENABLE ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVP3EN,    RCC_PLLDIVP_ENABLE ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVR2EN,    RCC_PLLDIVR_ENABLE ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVQ2EN,    RCC_PLLDIVQ_ENABLE ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVP2EN,    RCC_PLLDIVP_ENABLE ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVR1EN,    RCC_PLLDIVR_ENABLE ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVQ1EN,    RCC_PLLDIVQ_ENABLE ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, DIVP1EN,    RCC_PLLDIVP_ENABLE ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL3RGE,    PLL3_RGE           ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL3VCOSEL, PLL3_VCOSEL        ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL3FRACEN, PLL3_FRACEN        ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL2RGE,    PLL2_RGE           ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL2VCOSEL, PLL2_VCOSEL        ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL2FRACEN, PLL2_FRACEN        ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL1RGE,    PLL1_RGE           ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL1VCOSEL, PLL1_VCOSEL        ) |
+		REGISTER_FIELD_SETTER(RCC, PLLCFGR, PLL1FRACEN, PLL1_FRACEN        ) )
 	);
 
+	// Divider fields are programmed with the division factor minus 1
 	// PLL1 divider configuration
 	MODIFY_REG(RCC_COMMON->PLL1DIVR, (
-		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVR, RCC_PLLDIV2   ) |
-		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVQ, RCC_PLLDIV2   ) |
-		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVP, RCC_PLLDIV2   ) |
-		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVN, RCC_PLLDIV129 ) )
+		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVR, (PLL1_DIVR - 1UL) ) |
+		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVQ, (PLL1_DIVQ - 1UL) ) |
+		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVP, (PLL1_DIVP - 1UL) ) |
+		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVN, (PLL1_DIVN - 1UL) ) )
 	);
 
 	// PLL1 fractional divider configuration
 	MODIFY_REG(RCC_COMMON->PLL1FRACR, (
-		REGISTER_FIELD_SETTER(RCC, PLLFRACR, FRACN, 0x0UL ) )
+		REGISTER_FIELD_SETTER(RCC, PLLFRACR, FRACN, PLL1_FRACN ) )
 	);
 
 	// PLL2 divider configuration
 	MODIFY_REG(RCC_COMMON->PLL2DIVR, (
-		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVR, RCC_PLLDIV2   ) |
-		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVQ, RCC_PLLDIV2   ) |
-		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVP, RCC_PLLDIV2   ) |
-		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVN, RCC_PLLDIV129 ) )
+		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVR, (PLL2_DIVR - 1UL) ) |
+		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVQ, (PLL2_DIVQ - 1UL) ) |
+		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVP, (PLL2_DIVP - 1UL) ) |
+		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVN, (PLL2_DIVN - 1UL) ) )
 	);
 
 	// PLL2 fractional divider configuration
 	MODIFY_REG(RCC_COMMON->PLL2FRACR, (
-		REGISTER_FIELD_SETTER(RCC, PLLFRACR, FRACN, 0x0UL ) )
+		REGISTER_FIELD_SETTER(RCC, PLLFRACR, FRACN, PLL2_FRACN ) )
 	);
 
 	// PLL3 divider configuration
 	MODIFY_REG(RCC_COMMON->PLL3DIVR, (
-		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVR, RCC_PLLDIV2   ) |
-		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVQ, RCC_PLLDIV2   ) |
-		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVP, RCC_PLLDIV2   ) |
-		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVN, RCC_PLLDIV129 ) )
+		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVR, (PLL3_DIVR - 1UL) ) |
+		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVQ, (PLL3_DIVQ - 1UL) ) |
+		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVP, (PLL3_DIVP - 1UL) ) |
+		REGISTER_FIELD_SETTER(RCC, PLLDIVR, DIVN, (PLL3_DIVN - 1UL) ) )
 	);
 
 	// PLL3 fractional divider configuration
 	MODIFY_REG(RCC_COMMON->PLL3FRACR, (
-		REGISTER_FIELD_SETTER(RCC, PLLFRACR, FRACN, 0x0UL ) )
+		REGISTER_FIELD_SETTER(RCC, PLLFRACR, FRACN, PLL3_FRACN ) )
 	);
 
 	// Disable interrupts
@@ -157,4 +194,145 @@ void systemInit(void) {
 		REGISTER_FIELD_SETTER(RCC, CIER, LSIRDYIE,    RCC_CLKINT_DISABLE ) )
 	);
 
+	// Oscillator selected as PLL source must be ready before the PLLs are turned on. HSI is always on
+	if (PLL_SOURCE == RCC_PLLSRC_HSE) {
+		MODIFY_FIELD(RCC_COMMON->CR, RCC, CR, HSEON, RCC_CLK_ENABLE);
+		while (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, HSERDY) != RCC_CLK_READY) {
+		}
+	} else if (PLL_SOURCE == RCC_PLLSRC_CSI) {
+		MODIFY_FIELD(RCC_COMMON->CR, RCC, CR, CSION, RCC_CLK_ENABLE);
+		while (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, CSIRDY) != RCC_CLK_READY) {
+		}
+	}
+
+	// Start all PLLs. They lock while the startup code initializes memory running on HSI.
+	// The system clock is switched to PLL1 by systemClockSwitch once memory initialization is completed
+	SET_BITS(RCC_COMMON->CR, (
+		REGISTER_FIELD_SETTER(RCC, CR, PLL3ON, RCC_PLL_ENABLE ) |
+		REGISTER_FIELD_SETTER(RCC, CR, PLL2ON, RCC_PLL_ENABLE ) |
+		REGISTER_FIELD_SETTER(RCC, CR, PLL1ON, RCC_PLL_ENABLE ) )
+	);
+
+}
+
+static void system_bus_default_config(void) {
+
+	// PLL1 P output is the system clock. AXI and AHB clocks run at half of it and APB clocks at a quarter of it
+	MODIFY_REG(RCC_COMMON->D1CFGR, (
+		REGISTER_FIELD_SETTER(RCC, D1CFGR, D1CPRE, RCC_COREPRE_BYPASS ) |
+		REGISTER_FIELD_SETTER(RCC, D1CFGR, D1PPRE, RCC_APBPRE_DIV2    ) |
+		REGISTER_FIELD_SETTER(RCC, D1CFGR, HPRE,   RCC_AHBPRE_DIV2    ) )
+	);
+
+	MODIFY_REG(RCC_COMMON->D2CFGR, (
+		REGISTER_FIELD_SETTER(RCC, D2CFGR, D2PPRE2, RCC_APBPRE_DIV2 ) |
+		REGISTER_FIELD_SETTER(RCC, D2CFGR, D2PPRE1, RCC_APBPRE_DIV2 ) )
+	);
+
+	MODIFY_REG(RCC_COMMON->D3CFGR,
+		REGISTER_FIELD_SETTER(RCC, D3CFGR, D3PPRE, RCC_APBPRE_DIV2 )
+	);
+
+	// Flash latency is still at its reset value (7 wait states) hence it is safe to increase the frequency first
+	MODIFY_FIELD(RCC_COMMON->CFGR, RCC, CFGR, SW, RCC_SYSCLK_PLL1);
+	while (GET_FIELD_VALUE(RCC_COMMON->CFGR, RCC, CFGR, SWS) != RCC_SYSCLK_PLL1) {
+	}
+
+	dvfs_flash_wait_states_set(BOOT_VOLTAGE_SCALE, BOOT_AXI_FREQ);
+
+}
+
+void systemInit(void) {
+
+	bootTimelineStamp(BOOT_TIMELINE_SYSTEMINIT_ENTRY);
+
+	// Reset value of flash read latency is 7, hence start the procedure to increase the clock frequency if too low
+	if (GET_FIELD_VALUE(FLASH_BANK1->ACR, FLASH, ACR, LATENCY) < FLASH_LATENCY_7WAITSTATE) {
+		MODIFY_FIELD(FLASH_BANK1->ACR, FLASH, ACR, LATENCY, FLASH_LATENCY_7WAITSTATE);
+	}
+
+	// Image checksum is computed by the flash CRC unit while the clock tree and memory are initialized. It is checked by main
+	imageCrcStart();
+
+	// Enable HSI only
+	//MODIFY_REG(RCC_COMMON->CR, REGISTER_FIELD_SETTER(RCC, CR, HSION, RCC_CR_HSIEN_ENABLE))
+	MODIFY_FIELD(RCC_COMMON->CR, RCC, CR, HSION, RCC_CLK_ENABLE);
+
+	CLEAR_BITS(RCC_COMMON->CR, (
+		REGISTER_FIELD_SETTER(RCC, CR, HSION,    RCC_CLK_DISABLE    ) |
+		REGISTER_FIELD_SETTER(RCC, CR, HSIDIV,   RCC_HSIDIV_UPDATED ) |
+		REGISTER_FIELD_SETTER(RCC, CR, CSION,    RCC_CLK_DISABLE    ) |
+		REGISTER_FIELD_SETTER(RCC, CR, CSISMON,  RCC_CLK_DISABLE    ) |
+		REGISTER_FIELD_SETTER(RCC, CR, HSI48ON,  RCC_CLK_DISABLE    ) |
+		REGISTER_FIELD_SETTER(RCC, CR, HSEON,    RCC_CLK_DISABLE    ) |
+		REGISTER_FIELD_SETTER(RCC, CR, HSEBYP,   RCC_HSE_NOBYPASS   ) |
+		REGISTER_FIELD_SETTER(RCC, CR, HSECSSON, RCC_CLK_DISABLE    ) |
+		REGISTER_FIELD_SETTER(RCC, CR, PLL1ON,   RCC_PLL_DISABLE    ) |
+		REGISTER_FIELD_SETTER(RCC, CR, PLL2ON,   RCC_PLL_DISABLE    ) |
+		REGISTER_FIELD_SETTER(RCC, CR, PLL3ON,   RCC_PLL_DISABLE    ) )
+	);
+
+	// Backup SRAM holds the warm boot state hence its clock is enabled before the clock tree is configured
+	MODIFY_FIELD(RCC_COMMON->AHB4ENR, RCC, AHB4ENR, BKPRAMEN, RCC_PERIPHERALCLK_ENABLE);
+
+	// Supply must be configured and the core voltage must start rising before the PLLs are turned on
+	// Voltage scaling is not retained across system resets hence it is raised on warm boots too
+	system_voltage_scaling_start();
+
+	if (warmBootDetect() == true) {
+		// Software or watchdog reset: restore the clock tree configured by the previous boot
+		warmBootRestoreClock();
+	} else {
+		system_clock_default_config();
+	}
+
+	boot_phase.pll_start = cycle_counter_get();
+
+	// SRAMs in domain D2 are accessed by the startup code through the copy and zero tables
+	SET_BITS(RCC_COMMON->AHB2ENR, (
+		REGISTER_FIELD_SETTER(RCC, AHB2ENR, SRAM3EN, RCC_PERIPHERALCLK_ENABLE ) |
+		REGISTER_FIELD_SETTER(RCC, AHB2ENR, SRAM2EN, RCC_PERIPHERALCLK_ENABLE ) |
+		REGISTER_FIELD_SETTER(RCC, AHB2ENR, SRAM1EN, RCC_PERIPHERALCLK_ENABLE ) )
+	);
+
+	// Write access to the backup domain (bit DBP set) is required to update the backup SRAM
+	MODIFY_FIELD(PWR_COMMON->CR1, PWR, CR1, DBP, PWR_BCKWRPROT_ENABLE);
+
+	bootTimelineStamp(BOOT_TIMELINE_SYSTEMINIT_EXIT);
+
+}
+
+void systemClockSwitch(void) {
+
+	boot_phase.memory_init_end = cycle_counter_get();
+
+	// Wait for all PLLs turned on by systemInit to lock
+	while ((GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, PLL1RDY) != GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, PLL1ON)) ||
+	       (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, PLL2RDY) != GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, PLL2ON)) ||
+	       (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, PLL3RDY) != GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, PLL3ON))) {
+	}
+
+	boot_phase.pll_locked = cycle_counter_get();
+
+	// Core voltage must reach the scale required by the system clock before the switch
+	system_voltage_scaling_wait();
+
+	boot_phase.voltage_ready = cycle_counter_get();
+
+	if (warm_boot_is_active() == true) {
+		warmBootRestoreBus();
+	} else {
+		system_bus_default_config();
+	}
+
+	boot_phase.sysclk_switched = cycle_counter_get();
+
+}
+
+uint32_t boot_memory_init_cycles(void) {
+	return (boot_phase.memory_init_end - boot_phase.pll_start);
+}
+
+uint32_t boot_pll_wait_cycles(void) {
+	return (boot_phase.pll_locked - boot_phase.memory_init_end);
 }
@@ -45,42 +45,111 @@
 rst_event_handler:
 	ldr sp, =_max_stack_address		/* Initialize the stack pointer (R13) using LDR pseudo instruction */
 
+	/* Start the cycle counter as early as possible in order to measure the time taken to reach main */
+	bl cycleCounterInit			/* Branch with link to the C function enabling the data watchpoint and trace (DWT) cycle counter */
+	movs r0, 0x0				/* Boot phase BOOT_TIMELINE_RESET */
+	bl bootTimelineStamp			/* Branch with link to the C function recording the value of the cycle counter in the boot timeline */
+
 	/* This C function sets the reset and clock control to the desired reset state as well as a few other registers */
 	bl systemInit				/* Branch with link (i.e. call with the link register R14 being set to the next instruction) to the function to initialize system clocks
 						   It is a C function as we can leverage register macros hence have more readable code and easier to mantain */
 
-	/* Start copying data from the flash to the RAM */
-	movs r0, 0x0				/* Move immediate value 0 to r0 */
+	/* Walk the copy table emitted by the linker script and copy the data of every memory region from the flash to the RAM */
+	/* All bounds are loaded once and kept in registers for the whole copy of a region */
+	ldr r12, =_scopytable			/* Load start address of the copy table to r12 (descriptor pointer) */
+	ldr lr, =_ecopytable			/* Load end address of the copy table to lr. It is free to be used as main has not been called yet */
 
-	b copy_to_ram_loop			/* If the current address (r2) is smaller than the end of data section (r3), then branch back to copy data */
+	b copy_table_loop			/* Check bounds before reading the first descriptor */
 
-copy_to_ram_body:
-	ldr r2, =_asdata			/* Load value of absolute start address of the data in RAM to r2 */
+copy_table_body:
+	ldmia r12!, {r0-r2}			/* Load the descriptor: load address in FLASH to r0 (source pointer), run address to r1 (destination pointer) and size in bytes to r2 */
+	bic r3, r2, 0x1F			/* Round size down to a multiple of 32 bytes (8 words) */
+	adds r3, r1, r3				/* End address of the part of the region that can be copied using bursts of 8 words */
+	adds r2, r1, r2				/* End address of the region */
+
+	b copy_to_ram_burst_loop		/* Check bounds before copying the first burst */
 
-	ldr r2, [r2, r0]			/* Load the data at address of r2 offset by r0 into r2 */
-	str r2, [r1, r0]			/* Store the value loaded into r2 to address r1 + r0 */
+copy_to_ram_burst_body:
+	ldmia r0!, {r4-r11}			/* Load 8 words from address r0 to registers r4 to r11 and increment r0 by 32 */
+	stmia r1!, {r4-r11}			/* Store registers r4 to r11 to address r1 and increment r1 by 32 */
 
-	adds r0, r0, 0x4			/* Increment offset by 4 */
+copy_to_ram_burst_loop:
+	cmp r1, r3				/* Compare the current destination address (r1) with the end address of the burst copy (r3) */
+	blo copy_to_ram_burst_body		/* If the current address (r1) is smaller than the end address of the burst copy (r3), then branch back to copy 8 more words */
+
+	b copy_to_ram_loop			/* Copy remaining words one at a time */
+
+copy_to_ram_body:
+	ldr r4, [r0], 0x4			/* Load the word at address r0 into r4 and then increment r0 by 4 */
+	str r4, [r1], 0x4			/* Store the value in r4 to address r1 and then increment r1 by 4 */
 
 copy_to_ram_loop:
-	ldr r1, =_sdata				/* Load value of start address of the data in RAM to r1 */
-	ldr r2, =_edata				/* Load value of end address of the data in RAM to r2 */
-	adds r1, r1, r0				/* Calculate offset Load start address of the data in RAM with offset of r0 to r3 */
-	cmp r1, r2				/* Compare the address of the current memory location (r2) to copy with last address of the data section in the RAM (r2) */
+	cmp r1, r2				/* Compare the current destination address (r1) with the end address of the region (r2) */
+	blo copy_to_ram_body			/* If the current address (r1) is smaller than the end of the region (r2), then branch back to copy data */
+
+copy_table_loop:
+	cmp r12, lr				/* Compare the current descriptor address (r12) with the end address of the copy table (lr) */
+	blo copy_table_body			/* If there are descriptors left, then branch back to copy the next region */
+
+	dsb					/* Ensure that code copied to the instruction tightly coupled memory (ITCM) has been written */
+	isb					/* Flush the pipeline so that no instruction fetched before the copy is executed */
+
+	movs r0, 0x3				/* Boot phase BOOT_TIMELINE_DATA_COPIED */
+	bl bootTimelineStamp			/* Branch with link to the C function recording the value of the cycle counter in the boot timeline */
+
+	/* Walk the zero table emitted by the linker script and fill the uninitialized data of every memory region with zeros */
+	movs r4, 0x0				/* Clear registers r4 to r11 as they are stored in bursts */
+	movs r5, 0x0
+	movs r6, 0x0
+	movs r7, 0x0
+	mov r8, r4
+	mov r9, r4
+	mov r10, r4
+	mov r11, r4
+
+	ldr r12, =_szerotable			/* Load start address of the zero table to r12 (descriptor pointer) */
+	ldr lr, =_ezerotable			/* Load end address of the zero table to lr */
 
-	blo copy_to_ram_body			/* If the current address (r1) is smaller than the end of data section (r2), then branch back to copy data */
+	b zero_table_loop			/* Check bounds before reading the first descriptor */
 
-	ldr r1, =_sbss				/* Load value of start address of the unitialized in RAM to r1 */
-	b fill_bss_loop
+zero_table_body:
+	ldmia r12!, {r1-r2}			/* Load the descriptor: run address to r1 (destination pointer) and size in bytes to r2 */
+	bic r3, r2, 0x1F			/* Round size down to a multiple of 32 bytes (8 words) */
+	adds r3, r1, r3				/* End address of the part of the region that can be filled using bursts of 8 words */
+	adds r2, r1, r2				/* End address of the region */
+
+	b fill_bss_burst_loop			/* Check bounds before filling the first burst */
+
+fill_bss_burst_body:
+	stmia r1!, {r4-r11}			/* Store registers r4 to r11 (all 0) to address r1 and increment r1 by 32 */
+
+fill_bss_burst_loop:
+	cmp r1, r3				/* Compare the current address (r1) with the end address of the burst fill (r3) */
+	blo fill_bss_burst_body			/* If the current address (r1) is smaller than the end address of the burst fill (r3), then branch back to fill 8 more words */
+
+	b fill_bss_loop				/* Fill remaining words one at a time */
 
 fill_bss_body:
-	movs r2, 0x0				/* Move 0 into r2 */
-	str r2, [r1], 0x4			/* Store the value in r2 to address r1 and then increments r1 by 4 */
+	str r4, [r1], 0x4			/* Store the value in r4 (0) to address r1 and then increments r1 by 4 */
 
 fill_bss_loop:
-	ldr r2, =_ebss				/* Load value of end address of the data in flash to r2 */
-	cmp r1, r2				/* Compare the address of the current memory location (r2) to copy with last address of the data section in the RAM (r2) */
-	blo fill_bss_body			/* If the current address (r1) is smaller than the end of uninitialized data section (r2), then branch back to fill bss */
+	cmp r1, r2				/* Compare the current address (r1) with the end address of the region (r2) */
+	blo fill_bss_body			/* If the current address (r1) is smaller than the end of the region (r2), then branch back to fill bss */
+
+zero_table_loop:
+	cmp r12, lr				/* Compare the current descriptor address (r12) with the end address of the zero table (lr) */
+	blo zero_table_body			/* If there are descriptors left, then branch back to fill the next region */
+
+	movs r0, 0x4				/* Boot phase BOOT_TIMELINE_BSS_FILLED */
+	bl bootTimelineStamp			/* Branch with link to the C function recording the value of the cycle counter in the boot timeline */
+
+	/* PLLs started by systemInit have been locking while memory was being initialized */
+	bl systemClockSwitch			/* Branch with link to the C function switching the system clock to PLL1 once PLLs are locked */
+
+	/* Record the number of cycles elapsed since reset */
+	bl cycle_counter_get			/* Read the cycle counter. Its value is returned in r0 */
+	ldr r1, =boot_cycles			/* Load address of the variable holding the number of cycles taken to boot */
+	str r0, [r1]				/* Store the cycle count. The variable is in section .noinit so it is not touched by the initialization above */
 
 	bl main					/* Branch with link (i.e. call with the link register R14 being set to the next instruction) to the main function */
 	bx lr					/* Branch with indirect (return from call to main) */
@@ -89,17 +158,17 @@ fill_bss_loop:
 
 /**
 * @brief  This is the code that gets called when the processor receives an
-*         unexpected interrupt.  This simply enters an infinite loop, preserving
-*         the system state for examination by a debugger.
+*         unexpected interrupt. It tail calls a C function that accounts for
+*         the interrupt and disables it if it fires too often. Faults still
+*         enter an infinite loop, preserving the system state for examination
+*         by a debugger.
 * @param  None
 * @retval None
 */
 /* Define a section named .text.default_handler */
-/* Keep being stuck here if unexpected interrupt is triggered */
 .section  .text.default_interrupt_handler,"ax",%progbits
 default_interrupt_handler:
-infinite:
-	b  infinite
+	b spuriousInterruptHandler		/* Branch without link: lr still holds the exception return value hence the C function returns from the exception */
 .size  default_interrupt_handler, .-default_interrupt_handler	/* Give size information for the code of the syscall */
 
 .section  .isr_vector,"a",%progbits
@@ -284,468 +353,41 @@ g_pfnVectors:
 * this definition.
 *
 *******************************************************************************/
-.weak      NMI_handler
-.thumb_set NMI_handler,default_interrupt_handler
-
-.weak      HardFault_handler
-.thumb_set HardFault_handler,default_interrupt_handler
-
-.weak      MemManage_handler
-.thumb_set MemManage_handler,default_interrupt_handler
-
-.weak      BusFault_handler
-.thumb_set BusFault_handler,default_interrupt_handler
-
-.weak      UsageFault_handler
-.thumb_set UsageFault_handler,default_interrupt_handler
-
-.weak      SVCall_handler
-.thumb_set SVCall_handler,default_interrupt_handler
-
-.weak      DebugMonitor_handler
-.thumb_set DebugMonitor_handler,default_interrupt_handler
-
-.weak      PendSV_handler
-.thumb_set PendSV_handler,default_interrupt_handler
-
-.weak      SysTick_handler
-.thumb_set SysTick_handler,default_interrupt_handler
-
-.weak      WWDG_irq_handler
-.thumb_set WWDG_irq_handler,default_interrupt_handler
-
-.weak      PVD_irq_handler
-.thumb_set PVD_irq_handler,default_interrupt_handler
-
-.weak      TAMP_STAMP_irq_handler
-.thumb_set TAMP_STAMP_irq_handler,default_interrupt_handler
-
-.weak      RTC_WKUP_irq_handler
-.thumb_set RTC_WKUP_irq_handler,default_interrupt_handler
-
-.weak      FLASH_irq_handler
-.thumb_set FLASH_irq_handler,default_interrupt_handler
-
-.weak      RCC_irq_handler
-.thumb_set RCC_irq_handler,default_interrupt_handler
-
-.weak      EXTI0_irq_handler
-.thumb_set EXTI0_irq_handler,default_interrupt_handler
-
-.weak      EXTI1_irq_handler
-.thumb_set EXTI1_irq_handler,default_interrupt_handler
-
-.weak      EXTI2_irq_handler
-.thumb_set EXTI2_irq_handler,default_interrupt_handler
-
-.weak      EXTI3_irq_handler
-.thumb_set EXTI3_irq_handler,default_interrupt_handler
-
-.weak      EXTI4_irq_handler
-.thumb_set EXTI4_irq_handler,default_interrupt_handler
-
-.weak      DMA1_Stream0_irq_handler
-.thumb_set DMA1_Stream0_irq_handler,default_interrupt_handler
-
-.weak      DMA1_Stream1_irq_handler
-.thumb_set DMA1_Stream1_irq_handler,default_interrupt_handler
-
-.weak      DMA1_Stream2_irq_handler
-.thumb_set DMA1_Stream2_irq_handler,default_interrupt_handler
-
-.weak      DMA1_Stream3_irq_handler
-.thumb_set DMA1_Stream3_irq_handler,default_interrupt_handler
-
-.weak      DMA1_Stream4_irq_handler
-.thumb_set DMA1_Stream4_irq_handler,default_interrupt_handler
-
-.weak      DMA1_Stream5_irq_handler
-.thumb_set DMA1_Stream5_irq_handler,default_interrupt_handler
-
-.weak      DMA1_Stream6_irq_handler
-.thumb_set DMA1_Stream6_irq_handler,default_interrupt_handler
-
-.weak      ADC1_ADC2_irq_handler
-.thumb_set ADC1_ADC2_irq_handler,default_interrupt_handler
-
-.weak      FDCAN1_IT0_irq_handler
-.thumb_set FDCAN1_IT0_irq_handler,default_interrupt_handler
-
-.weak      FDCAN2_IT0_irq_handler
-.thumb_set FDCAN2_IT0_irq_handler,default_interrupt_handler
-
-.weak      FDCAN1_IT1_irq_handler
-.thumb_set FDCAN1_IT1_irq_handler,default_interrupt_handler
-
-.weak      FDCAN2_IT1_irq_handler
-.thumb_set FDCAN2_IT1_irq_handler,default_interrupt_handler
-
-.weak      EXTI9_5_irq_handler
-.thumb_set EXTI9_5_irq_handler,default_interrupt_handler
-
-.weak      TIM1_BRK_irq_handler
-.thumb_set TIM1_BRK_irq_handler,default_interrupt_handler
-
-.weak      TIM1_UP_irq_handler
-.thumb_set TIM1_UP_irq_handler,default_interrupt_handler
-
-.weak      TIM1_TRG_COM_irq_handler
-.thumb_set TIM1_TRG_COM_irq_handler,default_interrupt_handler
-
-.weak      TIM1_CC_irq_handler
-.thumb_set TIM1_CC_irq_handler,default_interrupt_handler
-
-.weak      TIM2_irq_handler
-.thumb_set TIM2_irq_handler,default_interrupt_handler
-
-.weak      TIM3_irq_handler
-.thumb_set TIM3_irq_handler,default_interrupt_handler
-
-.weak      TIM4_irq_handler
-.thumb_set TIM4_irq_handler,default_interrupt_handler
-
-.weak      I2C1_EV_irq_handler
-.thumb_set I2C1_EV_irq_handler,default_interrupt_handler
-
-.weak      I2C1_ER_irq_handler
-.thumb_set I2C1_ER_irq_handler,default_interrupt_handler
-
-.weak      I2C2_EV_irq_handler
-.thumb_set I2C2_EV_irq_handler,default_interrupt_handler
-
-.weak      I2C2_ER_irq_handler
-.thumb_set I2C2_ER_irq_handler,default_interrupt_handler
-
-.weak      SPI1_irq_handler
-.thumb_set SPI1_irq_handler,default_interrupt_handler
-
-.weak      SPI2_irq_handler
-.thumb_set SPI2_irq_handler,default_interrupt_handler
-
-.weak      USART1_irq_handler
-.thumb_set USART1_irq_handler,default_interrupt_handler
-
-.weak      USART2_irq_handler
-.thumb_set USART2_irq_handler,default_interrupt_handler
-
-.weak      USART3_irq_handler
-.thumb_set USART3_irq_handler,default_interrupt_handler
-
-.weak      EXTI15_10_irq_handler
-.thumb_set EXTI15_10_irq_handler,default_interrupt_handler
-
-.weak      RTC_Alarm_irq_handler
-.thumb_set RTC_Alarm_irq_handler,default_interrupt_handler
-
-.weak      TIM8_BRK_TIM12_irq_handler
-.thumb_set TIM8_BRK_TIM12_irq_handler,default_interrupt_handler
-
-.weak      TIM8_UP_TIM13_irq_handler
-.thumb_set TIM8_UP_TIM13_irq_handler,default_interrupt_handler
-
-.weak      TIM8_TRG_COM_TIM14_irq_handler
-.thumb_set TIM8_TRG_COM_TIM14_irq_handler,default_interrupt_handler
-
-.weak      TIM8_CC_irq_handler
-.thumb_set TIM8_CC_irq_handler,default_interrupt_handler
-
-.weak      DMA1_Stream7_irq_handler
-.thumb_set DMA1_Stream7_irq_handler,default_interrupt_handler
-
-.weak      FMC_irq_handler
-.thumb_set FMC_irq_handler,default_interrupt_handler
-
-.weak      SDMMC1_irq_handler
-.thumb_set SDMMC1_irq_handler,default_interrupt_handler
-
-.weak      TIM5_irq_handler
-.thumb_set TIM5_irq_handler,default_interrupt_handler
-
-.weak      SPI3_irq_handler
-.thumb_set SPI3_irq_handler,default_interrupt_handler
-
-.weak      UART4_irq_handler
-.thumb_set UART4_irq_handler,default_interrupt_handler
-
-.weak      UART5_irq_handler
-.thumb_set UART5_irq_handler,default_interrupt_handler
-
-.weak      TIM6_DAC_irq_handler
-.thumb_set TIM6_DAC_irq_handler,default_interrupt_handler
-
-.weak      TIM7_irq_handler
-.thumb_set TIM7_irq_handler,default_interrupt_handler
-
-.weak      DMA2_Stream0_irq_handler
-.thumb_set DMA2_Stream0_irq_handler,default_interrupt_handler
-
-.weak      DMA2_Stream1_irq_handler
-.thumb_set DMA2_Stream1_irq_handler,default_interrupt_handler
-
-.weak      DMA2_Stream2_irq_handler
-.thumb_set DMA2_Stream2_irq_handler,default_interrupt_handler
-
-.weak      DMA2_Stream3_irq_handler
-.thumb_set DMA2_Stream3_irq_handler,default_interrupt_handler
-
-.weak      DMA2_Stream4_irq_handler
-.thumb_set DMA2_Stream4_irq_handler,default_interrupt_handler
-
-.weak      ETH_irq_handler
-.thumb_set ETH_irq_handler,default_interrupt_handler
-
-.weak      ETH_WKUP_irq_handler
-.thumb_set ETH_WKUP_irq_handler,default_interrupt_handler
-
-.weak      FDCAN_CAL_irq_handler
-.thumb_set FDCAN_CAL_irq_handler,default_interrupt_handler
-
-.weak      CM7_SEV_irq_handler
-.thumb_set CM7_SEV_irq_handler,default_interrupt_handler
-
-.weak      CM4_SEV_irq_handler
-.thumb_set CM4_SEV_irq_handler,default_interrupt_handler
-
-.weak      DMA2_Stream5_irq_handler
-.thumb_set DMA2_Stream5_irq_handler,default_interrupt_handler
-
-.weak      DMA2_Stream6_irq_handler
-.thumb_set DMA2_Stream6_irq_handler,default_interrupt_handler
-
-.weak      DMA2_Stream7_irq_handler
-.thumb_set DMA2_Stream7_irq_handler,default_interrupt_handler
-
-.weak      USART6_irq_handler
-.thumb_set USART6_irq_handler,default_interrupt_handler
-
-.weak      I2C3_EV_irq_handler
-.thumb_set I2C3_EV_irq_handler,default_interrupt_handler
-
-.weak      I2C3_ER_irq_handler
-.thumb_set I2C3_ER_irq_handler,default_interrupt_handler
-
-.weak      USB_OTG_HS_EP1_OUT_irq_handler
-.thumb_set USB_OTG_HS_EP1_OUT_irq_handler,default_interrupt_handler
-
-.weak      USB_OTG_HS_EP1_IN_irq_handler
-.thumb_set USB_OTG_HS_EP1_IN_irq_handler,default_interrupt_handler
-
-.weak      USB_OTG_HS_WKUP_irq_handler
-.thumb_set USB_OTG_HS_WKUP_irq_handler,default_interrupt_handler
-
-.weak      USB_OTG_HS_irq_handler
-.thumb_set USB_OTG_HS_irq_handler,default_interrupt_handler
-
-.weak      DCMI_irq_handler
-.thumb_set DCMI_irq_handler,default_interrupt_handler
-
-.weak      CRYP_irq_handler
-.thumb_set CRYP_irq_handler,default_interrupt_handler
-
-.weak      RNG_irq_handler
-.thumb_set RNG_irq_handler,default_interrupt_handler
-
-.weak      FPU_irq_handler
-.thumb_set FPU_irq_handler,default_interrupt_handler
-
-.weak      UART7_irq_handler
-.thumb_set UART7_irq_handler,default_interrupt_handler
-
-.weak      UART8_irq_handler
-.thumb_set UART8_irq_handler,default_interrupt_handler
-
-.weak      SPI4_irq_handler
-.thumb_set SPI4_irq_handler,default_interrupt_handler
-
-.weak      SPI5_irq_handler
-.thumb_set SPI5_irq_handler,default_interrupt_handler
-
-.weak      SPI6_irq_handler
-.thumb_set SPI6_irq_handler,default_interrupt_handler
-
-.weak      SAI1_irq_handler
-.thumb_set SAI1_irq_handler,default_interrupt_handler
-
-.weak      LTDC_irq_handler
-.thumb_set LTDC_irq_handler,default_interrupt_handler
-
-.weak      LTDC_ER_irq_handler
-.thumb_set LTDC_ER_irq_handler,default_interrupt_handler
-
-.weak      DMA2D_irq_handler
-.thumb_set DMA2D_irq_handler,default_interrupt_handler
-
-.weak      SAI2_irq_handler
-.thumb_set SAI2_irq_handler,default_interrupt_handler
-
-.weak      QUADSPI_irq_handler
-.thumb_set QUADSPI_irq_handler,default_interrupt_handler
-
-.weak      LPTIM1_irq_handler
-.thumb_set LPTIM1_irq_handler,default_interrupt_handler
-
-.weak      CEC_irq_handler
-.thumb_set CEC_irq_handler,default_interrupt_handler
-
-.weak      I2C4_EV_irq_handler
-.thumb_set I2C4_EV_irq_handler,default_interrupt_handler
-
-.weak      I2C4_ER_irq_handler
-.thumb_set I2C4_ER_irq_handler,default_interrupt_handler
-
-.weak      SPDIF_RX_irq_handler
-.thumb_set SPDIF_RX_irq_handler,default_interrupt_handler
-
-.weak      USB_OTG_FS_EP1_OUT_irq_handler
-.thumb_set USB_OTG_FS_EP1_OUT_irq_handler,default_interrupt_handler
-
-.weak      USB_OTG_FS_EP1_IN_irq_handler
-.thumb_set USB_OTG_FS_EP1_IN_irq_handler,default_interrupt_handler
-
-.weak      USB_OTG_FS_WKUP_irq_handler
-.thumb_set USB_OTG_FS_WKUP_irq_handler,default_interrupt_handler
-
-.weak      USB_OTG_FS_irq_handler
-.thumb_set USB_OTG_FS_irq_handler,default_interrupt_handler
-
-.weak      DMAMUX1_OVR_irq_handler
-.thumb_set DMAMUX1_OVR_irq_handler,default_interrupt_handler
-
-.weak      HRTIM1_Master_irq_handler
-.thumb_set HRTIM1_Master_irq_handler,default_interrupt_handler
-
-.weak      HRTIM1_TIMA_irq_handler
-.thumb_set HRTIM1_TIMA_irq_handler,default_interrupt_handler
-
-.weak      HRTIM1_TIMB_irq_handler
-.thumb_set HRTIM1_TIMB_irq_handler,default_interrupt_handler
-
-.weak      HRTIM1_TIMC_irq_handler
-.thumb_set HRTIM1_TIMC_irq_handler,default_interrupt_handler
-
-.weak      HRTIM1_TIMD_irq_handler
-.thumb_set HRTIM1_TIMD_irq_handler,default_interrupt_handler
-
-.weak      HRTIM1_TIME_irq_handler
-.thumb_set HRTIM1_TIME_irq_handler,default_interrupt_handler
-
-.weak      HRTIM1_FLT_irq_handler
-.thumb_set HRTIM1_FLT_irq_handler,default_interrupt_handler
-
-.weak      DFSDM1_FLT0_irq_handler
-.thumb_set DFSDM1_FLT0_irq_handler,default_interrupt_handler
-
-.weak      DFSDM1_FLT1_irq_handler
-.thumb_set DFSDM1_FLT1_irq_handler,default_interrupt_handler
-
-.weak      DFSDM1_FLT2_irq_handler
-.thumb_set DFSDM1_FLT2_irq_handler,default_interrupt_handler
-
-.weak      DFSDM1_FLT3_irq_handler
-.thumb_set DFSDM1_FLT3_irq_handler,default_interrupt_handler
-
-.weak      SAI3_irq_handler
-.thumb_set SAI3_irq_handler,default_interrupt_handler
-
-.weak      SWPMI1_irq_handler
-.thumb_set SWPMI1_irq_handler,default_interrupt_handler
-
-.weak      TIM15_irq_handler
-.thumb_set TIM15_irq_handler,default_interrupt_handler
-
-.weak      TIM16_irq_handler
-.thumb_set TIM16_irq_handler,default_interrupt_handler
-
-.weak      TIM17_irq_handler
-.thumb_set TIM17_irq_handler,default_interrupt_handler
-
-.weak      MDIOS_WKUP_irq_handler
-.thumb_set MDIOS_WKUP_irq_handler,default_interrupt_handler
-
-.weak      MDIOS_irq_handler
-.thumb_set MDIOS_irq_handler,default_interrupt_handler
-
-.weak      JPEG_irq_handler
-.thumb_set JPEG_irq_handler,default_interrupt_handler
-
-.weak      MDMA_irq_handler
-.thumb_set MDMA_irq_handler,default_interrupt_handler
-
-.weak      DSI_DSI_wakeup_irq_handler
-.thumb_set DSI_DSI_wakeup_irq_handler,default_interrupt_handler
-
-.weak      SDMMC2_irq_handler
-.thumb_set SDMMC2_irq_handler,default_interrupt_handler
-
-.weak      HSEM1_irq_handler
-.thumb_set HSEM1_irq_handler,default_interrupt_handler
-
-.weak      HSEM2_irq_handler
-.thumb_set HSEM2_irq_handler,default_interrupt_handler
-
-.weak      ADC3_irq_handler
-.thumb_set ADC3_irq_handler,default_interrupt_handler
-
-.weak      DMAMUX2_OVR_irq_handler
-.thumb_set DMAMUX2_OVR_irq_handler,default_interrupt_handler
-
-.weak      BDMA_Channel0_irq_handler
-.thumb_set BDMA_Channel0_irq_handler,default_interrupt_handler
-
-.weak      BDMA_Channel1_irq_handler
-.thumb_set BDMA_Channel1_irq_handler,default_interrupt_handler
-
-.weak      BDMA_Channel2_irq_handler
-.thumb_set BDMA_Channel2_irq_handler,default_interrupt_handler
-
-.weak      BDMA_Channel3_irq_handler
-.thumb_set BDMA_Channel3_irq_handler,default_interrupt_handler
-
-.weak      BDMA_Channel4_irq_handler
-.thumb_set BDMA_Channel4_irq_handler,default_interrupt_handler
-
-.weak      BDMA_Channel5_irq_handler
-.thumb_set BDMA_Channel5_irq_handler,default_interrupt_handler
-
-.weak      BDMA_Channel6_irq_handler
-.thumb_set BDMA_Channel6_irq_handler,default_interrupt_handler
-
-.weak      BDMA_Channel7_irq_handler
-.thumb_set BDMA_Channel7_irq_handler,default_interrupt_handler
-
-.weak      COMP1_irq_handler
-.thumb_set COMP1_irq_handler,default_interrupt_handler
-
-.weak      LPTIM2_irq_handler
-.thumb_set LPTIM2_irq_handler,default_interrupt_handler
-
-.weak      LPTIM3_irq_handler
-.thumb_set LPTIM3_irq_handler,default_interrupt_handler
-
-.weak      LPTIM4_irq_handler
-.thumb_set LPTIM4_irq_handler,default_interrupt_handler
-
-.weak      LPTIM5_irq_handler
-.thumb_set LPTIM5_irq_handler,default_interrupt_handler
-
-.weak      LPUART1_irq_handler
-.thumb_set LPUART1_irq_handler,default_interrupt_handler
-
-.weak      WWDG_RST_irq_handler
-.thumb_set WWDG_RST_irq_handler,default_interrupt_handler
-
-.weak      CRS_irq_handler
-.thumb_set CRS_irq_handler,default_interrupt_handler
-
-.weak      ECC_irq_handler
-.thumb_set ECC_irq_handler,default_interrupt_handler
-
-.weak      SAI4_irq_handler
-.thumb_set SAI4_irq_handler,default_interrupt_handler
-
-.weak      CPU_hold_irq_handler
-.thumb_set CPU_hold_irq_handler,default_interrupt_handler
-
-.weak      WAKEUP_PIN_irq_handler
-.thumb_set WAKEUP_PIN_irq_handler,default_interrupt_handler
-
+.macro weak_default_handler handler:req, handlers:vararg
+.weak      \handler
+.thumb_set \handler,default_interrupt_handler
+.ifnb \handlers
+weak_default_handler \handlers		/* Recurse on the remaining handlers */
+.endif
+.endm
+
+/* System exceptions */
+weak_default_handler NMI_handler, HardFault_handler, MemManage_handler, BusFault_handler, UsageFault_handler
+weak_default_handler SVCall_handler, DebugMonitor_handler, PendSV_handler, SysTick_handler
+
+/* External interrupts */
+weak_default_handler WWDG_irq_handler, PVD_irq_handler, TAMP_STAMP_irq_handler, RTC_WKUP_irq_handler, FLASH_irq_handler, RCC_irq_handler
+weak_default_handler EXTI0_irq_handler, EXTI1_irq_handler, EXTI2_irq_handler, EXTI3_irq_handler, EXTI4_irq_handler, DMA1_Stream0_irq_handler
+weak_default_handler DMA1_Stream1_irq_handler, DMA1_Stream2_irq_handler, DMA1_Stream3_irq_handler, DMA1_Stream4_irq_handler, DMA1_Stream5_irq_handler, DMA1_Stream6_irq_handler
+weak_default_handler ADC1_ADC2_irq_handler, FDCAN1_IT0_irq_handler, FDCAN2_IT0_irq_handler, FDCAN1_IT1_irq_handler, FDCAN2_IT1_irq_handler, EXTI9_5_irq_handler
+weak_default_handler TIM1_BRK_irq_handler, TIM1_UP_irq_handler, TIM1_TRG_COM_irq_handler, TIM1_CC_irq_handler, TIM2_irq_handler, TIM3_irq_handler
+weak_default_handler TIM4_irq_handler, I2C1_EV_irq_handler, I2C1_ER_irq_handler, I2C2_EV_irq_handler, I2C2_ER_irq_handler, SPI1_irq_handler
+weak_default_handler SPI2_irq_handler, USART1_irq_handler, USART2_irq_handler, USART3_irq_handler, EXTI15_10_irq_handler, RTC_Alarm_irq_handler
+weak_default_handler TIM8_BRK_TIM12_irq_handler, TIM8_UP_TIM13_irq_handler, TIM8_TRG_COM_TIM14_irq_handler, TIM8_CC_irq_handler, DMA1_Stream7_irq_handler, FMC_irq_handler
+weak_default_handler SDMMC1_irq_handler, TIM5_irq_handler, SPI3_irq_handler, UART4_irq_handler, UART5_irq_handler, TIM6_DAC_irq_handler
+weak_default_handler TIM7_irq_handler, DMA2_Stream0_irq_handler, DMA2_Stream1_irq_handler, DMA2_Stream2_irq_handler, DMA2_Stream3_irq_handler, DMA2_Stream4_irq_handler
+weak_default_handler ETH_irq_handler, ETH_WKUP_irq_handler, FDCAN_CAL_irq_handler, CM7_SEV_irq_handler, CM4_SEV_irq_handler, DMA2_Stream5_irq_handler
+weak_default_handler DMA2_Stream6_irq_handler, DMA2_Stream7_irq_handler, USART6_irq_handler, I2C3_EV_irq_handler, I2C3_ER_irq_handler, USB_OTG_HS_EP1_OUT_irq_handler
+weak_default_handler USB_OTG_HS_EP1_IN_irq_handler, USB_OTG_HS_WKUP_irq_handler, USB_OTG_HS_irq_handler, DCMI_irq_handler, CRYP_irq_handler, RNG_irq_handler
+weak_default_handler FPU_irq_handler, UART7_irq_handler, UART8_irq_handler, SPI4_irq_handler, SPI5_irq_handler, SPI6_irq_handler
+weak_default_handler SAI1_irq_handler, LTDC_irq_handler, LTDC_ER_irq_handler, DMA2D_irq_handler, SAI2_irq_handler, QUADSPI_irq_handler
+weak_default_handler LPTIM1_irq_handler, CEC_irq_handler, I2C4_EV_irq_handler, I2C4_ER_irq_handler, SPDIF_RX_irq_handler, USB_OTG_FS_EP1_OUT_irq_handler
+weak_default_handler USB_OTG_FS_EP1_IN_irq_handler, USB_OTG_FS_WKUP_irq_handler, USB_OTG_FS_irq_handler, DMAMUX1_OVR_irq_handler, HRTIM1_Master_irq_handler, HRTIM1_TIMA_irq_handler
+weak_default_handler HRTIM1_TIMB_irq_handler, HRTIM1_TIMC_irq_handler, HRTIM1_TIMD_irq_handler, HRTIM1_TIME_irq_handler, HRTIM1_FLT_irq_handler, DFSDM1_FLT0_irq_handler
+weak_default_handler DFSDM1_FLT1_irq_handler, DFSDM1_FLT2_irq_handler, DFSDM1_FLT3_irq_handler, SAI3_irq_handler, SWPMI1_irq_handler, TIM15_irq_handler
+weak_default_handler TIM16_irq_handler, TIM17_irq_handler, MDIOS_WKUP_irq_handler, MDIOS_irq_handler, JPEG_irq_handler, MDMA_irq_handler
+weak_default_handler DSI_DSI_wakeup_irq_handler, SDMMC2_irq_handler, HSEM1_irq_handler, HSEM2_irq_handler, ADC3_irq_handler, DMAMUX2_OVR_irq_handler
+weak_default_handler BDMA_Channel0_irq_handler, BDMA_Channel1_irq_handler, BDMA_Channel2_irq_handler, BDMA_Channel3_irq_handler, BDMA_Channel4_irq_handler, BDMA_Channel5_irq_handler
+weak_default_handler BDMA_Channel6_irq_handler, BDMA_Channel7_irq_handler, COMP1_irq_handler, LPTIM2_irq_handler, LPTIM3_irq_handler, LPTIM4_irq_handler
+weak_default_handler LPTIM5_irq_handler, LPUART1_irq_handler, WWDG_RST_irq_handler, CRS_irq_handler, ECC_irq_handler, SAI4_irq_handler
+weak_default_handler CPU_hold_irq_handler, WAKEUP_PIN_irq_handler
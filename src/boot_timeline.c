@@ -0,0 +1,57 @@
+/**
+ * @copyright
+ * @file boot_timeline.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Boot timeline functions
+ */
+
+#include "registers/peripheral/rcc.h"
+#include "boot/boot_timeline.h"
+#include "boot/sections.h"
+#include "utility/cycle_counter.h"
+
+boot_timeline_ring boot_timeline BKPSRAM_NOINIT;
+
+// Stamps of the current boot are collected in the AXI SRAM as the backup SRAM is not accessible until systemInit has completed
+static boot_timeline_entry boot_timeline_current NOINIT;
+
+void bootTimelineStamp(boot_timeline_phase phase) {
+	boot_timeline_current.stamps[phase] = cycle_counter_get();
+}
+
+void boot_timeline_commit(void) {
+
+	bootTimelineStamp(BOOT_TIMELINE_MAIN_ENTRY);
+
+	// Content of the backup SRAM is random after a power on reset
+	if ((boot_timeline.magic != BOOT_TIMELINE_MAGIC) || (boot_timeline.head >= BOOT_TIMELINE_DEPTH)) {
+		boot_timeline.head = 0;
+		boot_timeline.sequence = 0;
+		for (uint32_t entry = 0; entry < BOOT_TIMELINE_DEPTH; entry++) {
+			boot_timeline.entries[entry].sequence = 0;
+			boot_timeline.entries[entry].reset_cause = 0;
+			for (uint32_t phase = 0; phase < BOOT_TIMELINE_PHASE_NUMBER; phase++) {
+				boot_timeline.entries[entry].stamps[phase] = 0;
+			}
+		}
+		boot_timeline.magic = BOOT_TIMELINE_MAGIC;
+	}
+
+	boot_timeline_entry * entry = &boot_timeline.entries[boot_timeline.head];
+
+	// Sequence is written last so that the decoder can discard an entry whose write has been interrupted by a reset
+	entry->sequence = 0;
+	entry->reset_cause = GET_REG(RCC_COMMON->RSR);
+	for (uint32_t phase = 0; phase < BOOT_TIMELINE_PHASE_NUMBER; phase++) {
+		entry->stamps[phase] = boot_timeline_current.stamps[phase];
+	}
+	boot_timeline.sequence++;
+	entry->sequence = boot_timeline.sequence;
+
+	boot_timeline.head = (boot_timeline.head + 1) % BOOT_TIMELINE_DEPTH;
+
+	// Clear reset flags so that the next boot reports only its own reset cause
+	MODIFY_FIELD(RCC_COMMON->RSR, RCC, RSR, RMVF, RCC_RESETFLAG_CLEAR);
+
+}
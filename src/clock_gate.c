@@ -0,0 +1,121 @@
+/**
+ * @copyright
+ * @file clock_gate.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Peripheral clock gating functions
+ */
+
+#include "registers/peripheral/rcc.h"
+#include "clock/clock_gate.h"
+
+// Number of bits of an enable register
+#define CLOCK_GATE_BITS 32U
+
+// Memories keep their clock in sleep mode so that DMA transfers can go on
+static const uint32_t clock_gate_sleep_memories[CLOCK_GATE_BUS_NUMBER] = {
+	[CLOCK_GATE_BUS_AHB3] = (
+		RCC_AHB3LPENR_AXISRAMLPEN_MASK |
+		RCC_AHB3LPENR_ITCMLPEN_MASK    |
+		RCC_AHB3LPENR_DTCM2LPEN_MASK   |
+		RCC_AHB3LPENR_D1DTCM1LPEN_MASK |
+		RCC_AHB3LPENR_FLITFLPEN_MASK   ),
+	[CLOCK_GATE_BUS_AHB2] = (
+		RCC_AHB2LPENR_SRAM3LPEN_MASK |
+		RCC_AHB2LPENR_SRAM2LPEN_MASK |
+		RCC_AHB2LPENR_SRAM1LPEN_MASK ),
+	[CLOCK_GATE_BUS_AHB4] = (
+		RCC_AHB4LPENR_SRAM4LPEN_MASK  |
+		RCC_AHB4LPENR_BKPRAMLPEN_MASK )
+};
+
+static uint8_t clock_gate_run_holds[CLOCK_GATE_BUS_NUMBER][CLOCK_GATE_BITS];
+static uint8_t clock_gate_sleep_holds[CLOCK_GATE_BUS_NUMBER][CLOCK_GATE_BITS];
+
+// Enable registers and low power enable registers are contiguous and in the same order as the buses
+static volatile uint32_t * clock_gate_get_enr(uint32_t bus) {
+	return (&RCC_COMMON->AHB3ENR + bus);
+}
+
+static volatile uint32_t * clock_gate_get_lpenr(uint32_t bus) {
+	return (&RCC_COMMON->AHB3LPENR + bus);
+}
+
+void clock_gate_init(void) {
+
+	for (uint32_t bus = 0; bus < CLOCK_GATE_BUS_NUMBER; bus++) {
+		const uint32_t enr = GET_REG(*clock_gate_get_enr(bus));
+		for (uint32_t bit = 0; bit < CLOCK_GATE_BITS; bit++) {
+			clock_gate_run_holds[bus][bit] = (uint8_t)((enr >> bit) & 0x1UL);
+			clock_gate_sleep_holds[bus][bit] = (uint8_t)((enr >> bit) & 0x1UL);
+		}
+		MODIFY_REG(*clock_gate_get_lpenr(bus), (clock_gate_sleep_memories[bus] | enr));
+	}
+
+}
+
+void clock_gate_acquire(clock_gate_id id, bool sleep) {
+
+	const uint32_t bus = id >> CLOCK_GATE_BUS_SHIFT;
+	const uint32_t bit = id & CLOCK_GATE_BIT_MASK;
+
+	if (bus >= CLOCK_GATE_BUS_NUMBER) {
+		return;
+	}
+
+	if (clock_gate_run_holds[bus][bit] == 0) {
+		SET_BITS(*clock_gate_get_enr(bus), (0x1UL << bit));
+		// Read back to make sure the clock is running before the peripheral is accessed
+		(void)GET_REG(*clock_gate_get_enr(bus));
+	}
+	clock_gate_run_holds[bus][bit]++;
+
+	if (sleep == true) {
+		if (clock_gate_sleep_holds[bus][bit] == 0) {
+			SET_BITS(*clock_gate_get_lpenr(bus), (0x1UL << bit));
+		}
+		clock_gate_sleep_holds[bus][bit]++;
+	}
+
+}
+
+void clock_gate_release(clock_gate_id id, bool sleep) {
+
+	const uint32_t bus = id >> CLOCK_GATE_BUS_SHIFT;
+	const uint32_t bit = id & CLOCK_GATE_BIT_MASK;
+
+	if ((bus >= CLOCK_GATE_BUS_NUMBER) || (clock_gate_run_holds[bus][bit] == 0)) {
+		return;
+	}
+
+	if ((sleep == true) && (clock_gate_sleep_holds[bus][bit] > 0)) {
+		clock_gate_sleep_holds[bus][bit]--;
+		if ((clock_gate_sleep_holds[bus][bit] == 0) && ((clock_gate_sleep_memories[bus] & (0x1UL << bit)) == 0)) {
+			CLEAR_BITS(*clock_gate_get_lpenr(bus), (0x1UL << bit));
+		}
+	}
+
+	clock_gate_run_holds[bus][bit]--;
+	if (clock_gate_run_holds[bus][bit] == 0) {
+		CLEAR_BITS(*clock_gate_get_enr(bus), (0x1UL << bit));
+	}
+
+}
+
+uint32_t clock_gate_get_holds(clock_gate_id id) {
+
+	const uint32_t bus = id >> CLOCK_GATE_BUS_SHIFT;
+
+	if (bus >= CLOCK_GATE_BUS_NUMBER) {
+		return 0;
+	}
+
+	return clock_gate_run_holds[bus][id & CLOCK_GATE_BIT_MASK];
+}
+
+void clock_gate_get_report(clock_gate_report * report) {
+	for (uint32_t bus = 0; bus < CLOCK_GATE_BUS_NUMBER; bus++) {
+		report->run[bus] = GET_REG(*clock_gate_get_enr(bus));
+		report->sleep[bus] = GET_REG(*clock_gate_get_lpenr(bus));
+	}
+}
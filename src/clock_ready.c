@@ -0,0 +1,120 @@
+/**
+ * @copyright
+ * @file clock_ready.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Asynchronous oscillator and PLL start functions
+ */
+
+#include <stddef.h>
+
+#include "registers/peripheral/rcc.h"
+#include "clock/clock_ready.h"
+#include "boot/irq.h"
+
+IRQ_DECLARE(RCC, IRQ_PRIORITY_LOWEST);
+
+static clock_ready_callback clock_ready_callbacks[CLOCK_READY_NUMBER];
+static volatile uint32_t clock_ready_pending;
+
+// Turn on the clock source and return whether it is ready
+static bool clock_ready_turn_on(clock_ready_source source) {
+	switch (source) {
+		case CLOCK_READY_LSI:
+			MODIFY_FIELD(RCC_COMMON->CSR, RCC, CSR, LSION, RCC_LSI_ON);
+			return (GET_FIELD_VALUE(RCC_COMMON->CSR, RCC, CSR, LSIRDY) == RCC_LSI_READY);
+		case CLOCK_READY_LSE:
+			MODIFY_FIELD(RCC_COMMON->BDCR, RCC, BDCR, LSEON, RCC_LSE_ON);
+			return (GET_FIELD_VALUE(RCC_COMMON->BDCR, RCC, BDCR, LSERDY) == RCC_LSE_READY);
+		case CLOCK_READY_HSI:
+			MODIFY_FIELD(RCC_COMMON->CR, RCC, CR, HSION, RCC_CLK_ENABLE);
+			return (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, HSIRDY) == RCC_CLK_READY);
+		case CLOCK_READY_HSE:
+			MODIFY_FIELD(RCC_COMMON->CR, RCC, CR, HSEON, RCC_CLK_ENABLE);
+			return (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, HSERDY) == RCC_CLK_READY);
+		case CLOCK_READY_CSI:
+			MODIFY_FIELD(RCC_COMMON->CR, RCC, CR, CSION, RCC_CLK_ENABLE);
+			return (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, CSIRDY) == RCC_CLK_READY);
+		case CLOCK_READY_HSI48:
+			MODIFY_FIELD(RCC_COMMON->CR, RCC, CR, HSI48ON, RCC_CLK_ENABLE);
+			return (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, HSI48RDY) == RCC_CLK_READY);
+		case CLOCK_READY_PLL1:
+			MODIFY_FIELD(RCC_COMMON->CR, RCC, CR, PLL1ON, RCC_PLL_ENABLE);
+			return (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, PLL1RDY) == RCC_PLL_LOCKED);
+		case CLOCK_READY_PLL2:
+			MODIFY_FIELD(RCC_COMMON->CR, RCC, CR, PLL2ON, RCC_PLL_ENABLE);
+			return (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, PLL2RDY) == RCC_PLL_LOCKED);
+		default:
+			MODIFY_FIELD(RCC_COMMON->CR, RCC, CR, PLL3ON, RCC_PLL_ENABLE);
+			return (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, PLL3RDY) == RCC_PLL_LOCKED);
+	}
+}
+
+bool clock_ready_start(clock_ready_source source, clock_ready_callback callback) {
+
+	if ((source >= CLOCK_READY_NUMBER) || (clock_ready_is_pending(source) == true)) {
+		return false;
+	}
+
+	const uint32_t mask = (0x1UL << source);
+
+	clock_ready_callbacks[source] = callback;
+
+	// RCC_irq_handler clears bits of the pending sources and of the interrupt enable register hence they are updated with interrupts masked
+	__asm__ volatile ("cpsid i" : : : "memory");
+
+	// Flag is cleared before the interrupt is enabled so that a stale ready event does not complete the start
+	MODIFY_REG(RCC_COMMON->CLKINTCLR, mask);
+	SET_BITS(clock_ready_pending, mask);
+	SET_BITS(RCC_COMMON->CIER, mask);
+
+	// Already running: the ready flag does not rise again
+	const bool ready = clock_ready_turn_on(source);
+	if (ready == true) {
+		CLEAR_BITS(RCC_COMMON->CIER, mask);
+		CLEAR_BITS(clock_ready_pending, mask);
+	}
+
+	__asm__ volatile ("cpsie i" : : : "memory");
+
+	if ((ready == true) && (callback != NULL)) {
+		callback(source);
+	}
+
+	return true;
+}
+
+bool clock_ready_is_pending(clock_ready_source source) {
+	return ((clock_ready_pending & (0x1UL << source)) != 0);
+}
+
+void clock_ready_wait(clock_ready_source source) {
+
+	while (true) {
+		// Interrupts are masked between the check and WFI so that the ready interrupt cannot be missed. WFI wakes up on pending interrupts anyway
+		__asm__ volatile ("cpsid i" : : : "memory");
+		if (clock_ready_is_pending(source) == false) {
+			__asm__ volatile ("cpsie i" : : : "memory");
+			break;
+		}
+		__asm__ volatile ("wfi");
+		__asm__ volatile ("cpsie i" : : : "memory");
+	}
+
+}
+
+void RCC_irq_handler(void) {
+
+	const uint32_t ready = GET_REG(RCC_COMMON->CLKINTFLAG) & GET_REG(RCC_COMMON->CIER) & clock_ready_pending;
+
+	MODIFY_REG(RCC_COMMON->CLKINTCLR, ready);
+	CLEAR_BITS(RCC_COMMON->CIER, ready);
+	CLEAR_BITS(clock_ready_pending, ready);
+
+	for (uint32_t source = 0; source < CLOCK_READY_NUMBER; source++) {
+		if (((ready & (0x1UL << source)) != 0) && (clock_ready_callbacks[source] != NULL)) {
+			clock_ready_callbacks[source]((clock_ready_source)source);
+		}
+	}
+
+}
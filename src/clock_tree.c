@@ -0,0 +1,200 @@
+/**
+ * @copyright
+ * @file clock_tree.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Clock tree query functions
+ */
+
+#include <stdbool.h>
+
+#include "registers/peripheral/rcc.h"
+#include "clock/clock_tree.h"
+#include "clock/kernel_clock.h"
+#include "clock/dvfs.h"
+#include "boot/pll.h"
+
+#if PLL_SOURCE == RCC_PLLSRC_HSE
+#define CLOCK_TREE_HSE_FREQ PLL_INPUT_FREQ
+#else
+// HSE of Nucleo boards is the 8 MHz clock output of the ST-LINK
+#define CLOCK_TREE_HSE_FREQ 8000000UL
+#endif // PLL_SOURCE == RCC_PLLSRC_HSE
+
+// Enable bits of the PLL outputs
+#define CLOCK_TREE_PLL_P_EN 0x1UL
+#define CLOCK_TREE_PLL_Q_EN 0x2UL
+#define CLOCK_TREE_PLL_R_EN 0x4UL
+
+// Right shift applied by the core and AHB prescalers for values from 8 (divide by 2) to 15 (divide by 512)
+static const uint8_t clock_tree_ahb_shifts[] = { 1U, 2U, 3U, 4U, 6U, 7U, 8U, 9U };
+
+static uint32_t clock_tree_freq[CLOCK_TREE_CLOCK_NUMBER];
+static volatile bool clock_tree_valid;
+
+static uint32_t clock_tree_ahb_shift(uint32_t prescaler) {
+	return (prescaler < RCC_AHBPRE_DIV2) ? 0U : clock_tree_ahb_shifts[prescaler - RCC_AHBPRE_DIV2];
+}
+
+static uint32_t clock_tree_apb_shift(uint32_t prescaler) {
+	return (prescaler < RCC_APBPRE_DIV2) ? 0U : (prescaler - RCC_APBPRE_DIV2 + 1U);
+}
+
+// Timers run at the AHB clock as long as the APB prescaler does not divide by more than the timer multiplier
+static uint32_t clock_tree_timer_freq(uint32_t hclk, uint32_t apb_shift, uint32_t timpre) {
+	const uint32_t mul_shift = (timpre == RCC_TIMERPRE_MUL4) ? 2U : 1U;
+	return (apb_shift <= mul_shift) ? hclk : (hclk >> (apb_shift - mul_shift));
+}
+
+static void clock_tree_pll_refresh(clock_tree_clock p_clock, uint32_t ref_freq, uint32_t divr, uint32_t fracn, uint32_t enables) {
+
+	// Fractional part is computed on the reference clock divided by 32 not to overflow 32 bits as FRACN has 13 bits
+	const uint32_t vco = (ref_freq * (GET_FIELD_VALUE(divr, RCC, PLLDIVR, DIVN) + 1UL)) + (((ref_freq >> 5) * fracn) >> 8);
+
+	clock_tree_freq[p_clock] = ((enables & CLOCK_TREE_PLL_P_EN) != 0) ? (vco / (GET_FIELD_VALUE(divr, RCC, PLLDIVR, DIVP) + 1UL)) : 0;
+	clock_tree_freq[p_clock + 1] = ((enables & CLOCK_TREE_PLL_Q_EN) != 0) ? (vco / (GET_FIELD_VALUE(divr, RCC, PLLDIVR, DIVQ) + 1UL)) : 0;
+	clock_tree_freq[p_clock + 2] = ((enables & CLOCK_TREE_PLL_R_EN) != 0) ? (vco / (GET_FIELD_VALUE(divr, RCC, PLLDIVR, DIVR) + 1UL)) : 0;
+
+}
+
+static void clock_tree_refresh(void) {
+
+	const uint32_t cr = GET_REG(RCC_COMMON->CR);
+	const uint32_t cfgr = GET_REG(RCC_COMMON->CFGR);
+	const uint32_t d1cfgr = GET_REG(RCC_COMMON->D1CFGR);
+	const uint32_t d2cfgr = GET_REG(RCC_COMMON->D2CFGR);
+	const uint32_t d3cfgr = GET_REG(RCC_COMMON->D3CFGR);
+	const uint32_t pllckselr = GET_REG(RCC_COMMON->PLLCKSELR);
+	const uint32_t pllcfgr = GET_REG(RCC_COMMON->PLLCFGR);
+	const uint32_t d1ccipr = GET_REG(RCC_COMMON->D1CCIPR);
+
+	// Oscillators
+	clock_tree_freq[CLOCK_TREE_NONE] = 0;
+	clock_tree_freq[CLOCK_TREE_HSI] = (GET_FIELD_VALUE(cr, RCC, CR, HSIRDY) == RCC_CLK_READY) ? (CLOCK_TREE_HSI_FREQ >> GET_FIELD_VALUE(cr, RCC, CR, HSIDIV)) : 0;
+	clock_tree_freq[CLOCK_TREE_CSI] = (GET_FIELD_VALUE(cr, RCC, CR, CSIRDY) == RCC_CLK_READY) ? CLOCK_TREE_CSI_FREQ : 0;
+	clock_tree_freq[CLOCK_TREE_HSE] = (GET_FIELD_VALUE(cr, RCC, CR, HSERDY) == RCC_CLK_READY) ? CLOCK_TREE_HSE_FREQ : 0;
+	clock_tree_freq[CLOCK_TREE_HSI48] = (GET_FIELD_VALUE(cr, RCC, CR, HSI48RDY) == RCC_CLK_READY) ? CLOCK_TREE_HSI48_FREQ : 0;
+	clock_tree_freq[CLOCK_TREE_LSI] = (GET_FIELD_VALUE(RCC_COMMON->CSR, RCC, CSR, LSIRDY) == RCC_LSI_READY) ? CLOCK_TREE_LSI_FREQ : 0;
+	clock_tree_freq[CLOCK_TREE_LSE] = (GET_FIELD_VALUE(RCC_COMMON->BDCR, RCC, BDCR, LSERDY) == RCC_LSE_READY) ? CLOCK_TREE_LSE_FREQ : 0;
+
+	// PLLs share the same source clock
+	uint32_t pll_source_freq = 0;
+	switch (GET_FIELD_VALUE(pllckselr, RCC, PLLCKSELR, PLLSRC)) {
+		case RCC_PLLSRC_HSI:
+			pll_source_freq = clock_tree_freq[CLOCK_TREE_HSI];
+			break;
+		case RCC_PLLSRC_CSI:
+			pll_source_freq = clock_tree_freq[CLOCK_TREE_CSI];
+			break;
+		case RCC_PLLSRC_HSE:
+			pll_source_freq = clock_tree_freq[CLOCK_TREE_HSE];
+			break;
+		default:
+			break;
+	}
+
+	const uint32_t divm1 = GET_FIELD_VALUE(pllckselr, RCC, PLLCKSELR, DIVM1);
+	const uint32_t divm2 = GET_FIELD_VALUE(pllckselr, RCC, PLLCKSELR, DIVM2);
+	const uint32_t divm3 = GET_FIELD_VALUE(pllckselr, RCC, PLLCKSELR, DIVM3);
+
+	// A PLL whose prescaler is disabled or that is not locked has no output
+	const uint32_t ref1 = ((divm1 == RCC_PLLPRE_DISABLE) || (GET_FIELD_VALUE(cr, RCC, CR, PLL1RDY) != RCC_PLL_LOCKED)) ? 0 : (pll_source_freq / divm1);
+	const uint32_t ref2 = ((divm2 == RCC_PLLPRE_DISABLE) || (GET_FIELD_VALUE(cr, RCC, CR, PLL2RDY) != RCC_PLL_LOCKED)) ? 0 : (pll_source_freq / divm2);
+	const uint32_t ref3 = ((divm3 == RCC_PLLPRE_DISABLE) || (GET_FIELD_VALUE(cr, RCC, CR, PLL3RDY) != RCC_PLL_LOCKED)) ? 0 : (pll_source_freq / divm3);
+
+	const uint32_t fracn1 = (GET_FIELD_VALUE(pllcfgr, RCC, PLLCFGR, PLL1FRACEN) == RCC_PLLFRAC_ENABLE) ? GET_FIELD_VALUE(RCC_COMMON->PLL1FRACR, RCC, PLLFRACR, FRACN) : 0;
+	const uint32_t fracn2 = (GET_FIELD_VALUE(pllcfgr, RCC, PLLCFGR, PLL2FRACEN) == RCC_PLLFRAC_ENABLE) ? GET_FIELD_VALUE(RCC_COMMON->PLL2FRACR, RCC, PLLFRACR, FRACN) : 0;
+	const uint32_t fracn3 = (GET_FIELD_VALUE(pllcfgr, RCC, PLLCFGR, PLL3FRACEN) == RCC_PLLFRAC_ENABLE) ? GET_FIELD_VALUE(RCC_COMMON->PLL3FRACR, RCC, PLLFRACR, FRACN) : 0;
+
+	const uint32_t enables1 = (GET_FIELD_VALUE(pllcfgr, RCC, PLLCFGR, DIVP1EN) * CLOCK_TREE_PLL_P_EN) | (GET_FIELD_VALUE(pllcfgr, RCC, PLLCFGR, DIVQ1EN) * CLOCK_TREE_PLL_Q_EN) | (GET_FIELD_VALUE(pllcfgr, RCC, PLLCFGR, DIVR1EN) * CLOCK_TREE_PLL_R_EN);
+	const uint32_t enables2 = (GET_FIELD_VALUE(pllcfgr, RCC, PLLCFGR, DIVP2EN) * CLOCK_TREE_PLL_P_EN) | (GET_FIELD_VALUE(pllcfgr, RCC, PLLCFGR, DIVQ2EN) * CLOCK_TREE_PLL_Q_EN) | (GET_FIELD_VALUE(pllcfgr, RCC, PLLCFGR, DIVR2EN) * CLOCK_TREE_PLL_R_EN);
+	const uint32_t enables3 = (GET_FIELD_VALUE(pllcfgr, RCC, PLLCFGR, DIVP3EN) * CLOCK_TREE_PLL_P_EN) | (GET_FIELD_VALUE(pllcfgr, RCC, PLLCFGR, DIVQ3EN) * CLOCK_TREE_PLL_Q_EN) | (GET_FIELD_VALUE(pllcfgr, RCC, PLLCFGR, DIVR3EN) * CLOCK_TREE_PLL_R_EN);
+
+	clock_tree_pll_refresh(CLOCK_TREE_PLL1P, ref1, GET_REG(RCC_COMMON->PLL1DIVR), fracn1, enables1);
+	clock_tree_pll_refresh(CLOCK_TREE_PLL2P, ref2, GET_REG(RCC_COMMON->PLL2DIVR), fracn2, enables2);
+	clock_tree_pll_refresh(CLOCK_TREE_PLL3P, ref3, GET_REG(RCC_COMMON->PLL3DIVR), fracn3, enables3);
+
+	switch (GET_FIELD_VALUE(d1ccipr, RCC, D1CCIPR, CLKPERSEL)) {
+		case RCC_CLKPERIPHERAL_HSI:
+			clock_tree_freq[CLOCK_TREE_PER] = clock_tree_freq[CLOCK_TREE_HSI];
+			break;
+		case RCC_CLKPERIPHERAL_CSI:
+			clock_tree_freq[CLOCK_TREE_PER] = clock_tree_freq[CLOCK_TREE_CSI];
+			break;
+		case RCC_CLKPERIPHERAL_HSE:
+			clock_tree_freq[CLOCK_TREE_PER] = clock_tree_freq[CLOCK_TREE_HSE];
+			break;
+		default:
+			clock_tree_freq[CLOCK_TREE_PER] = 0;
+			break;
+	}
+
+	// Bus clocks
+	switch (GET_FIELD_VALUE(cfgr, RCC, CFGR, SWS)) {
+		case RCC_SYSCLK_CSI:
+			clock_tree_freq[CLOCK_TREE_SYSCLK] = clock_tree_freq[CLOCK_TREE_CSI];
+			break;
+		case RCC_SYSCLK_HSE:
+			clock_tree_freq[CLOCK_TREE_SYSCLK] = clock_tree_freq[CLOCK_TREE_HSE];
+			break;
+		case RCC_SYSCLK_PLL1:
+			clock_tree_freq[CLOCK_TREE_SYSCLK] = clock_tree_freq[CLOCK_TREE_PLL1P];
+			break;
+		default:
+			clock_tree_freq[CLOCK_TREE_SYSCLK] = clock_tree_freq[CLOCK_TREE_HSI];
+			break;
+	}
+
+	const uint32_t cpu = clock_tree_freq[CLOCK_TREE_SYSCLK] >> clock_tree_ahb_shift(GET_FIELD_VALUE(d1cfgr, RCC, D1CFGR, D1CPRE));
+	const uint32_t hclk = cpu >> clock_tree_ahb_shift(GET_FIELD_VALUE(d1cfgr, RCC, D1CFGR, HPRE));
+	const uint32_t apb1_shift = clock_tree_apb_shift(GET_FIELD_VALUE(d2cfgr, RCC, D2CFGR, D2PPRE1));
+	const uint32_t apb2_shift = clock_tree_apb_shift(GET_FIELD_VALUE(d2cfgr, RCC, D2CFGR, D2PPRE2));
+	const uint32_t timpre = GET_FIELD_VALUE(cfgr, RCC, CFGR, TIMPRE);
+
+	clock_tree_freq[CLOCK_TREE_CPU] = cpu;
+	clock_tree_freq[CLOCK_TREE_HCLK] = hclk;
+	clock_tree_freq[CLOCK_TREE_PCLK1] = hclk >> apb1_shift;
+	clock_tree_freq[CLOCK_TREE_PCLK2] = hclk >> apb2_shift;
+	clock_tree_freq[CLOCK_TREE_PCLK3] = hclk >> clock_tree_apb_shift(GET_FIELD_VALUE(d1cfgr, RCC, D1CFGR, D1PPRE));
+	clock_tree_freq[CLOCK_TREE_PCLK4] = hclk >> clock_tree_apb_shift(GET_FIELD_VALUE(d3cfgr, RCC, D3CFGR, D3PPRE));
+	clock_tree_freq[CLOCK_TREE_TIMER1] = clock_tree_timer_freq(hclk, apb1_shift, timpre);
+	clock_tree_freq[CLOCK_TREE_TIMER2] = clock_tree_timer_freq(hclk, apb2_shift, timpre);
+
+	// Kernel clocks
+	for (uint32_t clock = CLOCK_TREE_KERNEL_FIRST; clock < CLOCK_TREE_CLOCK_NUMBER; clock++) {
+		clock_tree_freq[clock] = clock_tree_freq[kernel_clock_get_source((clock_tree_clock)clock)];
+	}
+
+	clock_tree_valid = true;
+
+}
+
+static void clock_tree_dvfs_notifier(dvfs_event event, const dvfs_profile_config * from, const dvfs_profile_config * to) {
+	(void)from;
+	(void)to;
+	if (event == DVFS_EVENT_POST_CHANGE) {
+		clock_tree_invalidate();
+	}
+}
+
+void clock_tree_init(void) {
+	clock_tree_invalidate();
+	(void)dvfs_register_notifier(clock_tree_dvfs_notifier);
+}
+
+uint32_t clock_tree_get_freq(clock_tree_clock clock) {
+
+	if (clock >= CLOCK_TREE_CLOCK_NUMBER) {
+		return 0;
+	}
+
+	if (clock_tree_valid == false) {
+		clock_tree_refresh();
+	}
+
+	return clock_tree_freq[clock];
+}
+
+void clock_tree_invalidate(void) {
+	clock_tree_valid = false;
+}
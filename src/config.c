@@ -8,7 +8,15 @@
 
 #include "registers/peripheral/rcc.h"
 #include "config/config.h"
+#include "clock/clock_gate.h"
+#include "clock/kernel_clock.h"
 
 void clk_config() {
 
+	// Clocks enabled so far are held on behalf of the startup code
+	clock_gate_init();
+
+	// Peripherals are clocked independently of the clock profile
+	kernel_clock_init();
+
 }
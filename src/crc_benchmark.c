@@ -0,0 +1,61 @@
+/**
+ * @copyright
+ * @file crc_benchmark.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief CRC benchmark functions
+ */
+
+#ifdef BENCHMARK
+
+#include "benchmark/crc_benchmark.h"
+#include "boot/image_crc.h"
+#include "boot/sections.h"
+#include "utility/cycle_counter.h"
+
+crc_benchmark_result crc_benchmark;
+
+// Lookup table is read from the DTCM so that only the flash reads of the data are accounted for
+static uint32_t crc_table[CRC_BENCHMARK_TABLE_SIZE] DTCM_BSS;
+
+static void crc_table_init(void) {
+	for (uint32_t idx = 0; idx < CRC_BENCHMARK_TABLE_SIZE; idx++) {
+		uint32_t crc = idx << 24;
+		for (uint32_t bit = 0; bit < 8U; bit++) {
+			crc = ((crc & 0x80000000UL) != 0) ? ((crc << 1) ^ IMAGE_CRC_POLYNOMIAL) : (crc << 1);
+		}
+		crc_table[idx] = crc;
+	}
+}
+
+// Same algorithm as the flash CRC unit: 32-bit words are fed most significant byte first, without reflection nor final XOR
+static uint32_t crc_software(const uint32_t * data, uint32_t words) {
+	uint32_t crc = IMAGE_CRC_INIT;
+	for (uint32_t idx = 0; idx < words; idx++) {
+		const uint32_t word = data[idx];
+		crc = (crc << 8) ^ crc_table[((crc >> 24) ^ (word >> 24)) & 0xFFU];
+		crc = (crc << 8) ^ crc_table[((crc >> 24) ^ (word >> 16)) & 0xFFU];
+		crc = (crc << 8) ^ crc_table[((crc >> 24) ^ (word >> 8)) & 0xFFU];
+		crc = (crc << 8) ^ crc_table[((crc >> 24) ^ word) & 0xFFU];
+	}
+	return crc;
+}
+
+void crc_benchmark_run(void) {
+
+	uint32_t start = 0;
+
+	crc_table_init();
+
+	start = cycle_counter_get();
+	image_crc_unit_start(FLASH_BANK1, 0, (IMAGE_CRC_BANK1_SIZE - sizeof(uint32_t)));
+	(void)image_crc_unit_wait(FLASH_BANK1, &crc_benchmark.hardware_crc);
+	crc_benchmark.hardware_cycles = cycle_counter_elapsed(start);
+
+	start = cycle_counter_get();
+	crc_benchmark.software_crc = crc_software((const uint32_t *)IMAGE_CRC_BANK1_START, (IMAGE_CRC_BANK1_SIZE / sizeof(uint32_t)));
+	crc_benchmark.software_cycles = cycle_counter_elapsed(start);
+
+}
+
+#endif // BENCHMARK
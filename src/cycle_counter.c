@@ -0,0 +1,31 @@
+/**
+ * @copyright
+ * @file cycle_counter.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Cycle counter functions
+ */
+
+#include "registers/cortexm7/debug.h"
+#include "registers/debug/cortexm7/dwt.h"
+#include "utility/cycle_counter.h"
+
+void cycleCounterInit(void) {
+
+	// DWT registers are only accessible if trace is enabled
+	MODIFY_FIELD(CORTEXM7DBG->DEMCR, DBG, DEMCR, TRCENA, DBG_TRACE_ENABLE);
+
+	// Software access to the DWT is locked out of reset on Cortex M7
+	MODIFY_REG(CORTEXM7DWT->LAR, KEY_LOCKCLEAR);
+
+	CLEAR_REG(CORTEXM7DWT->CYCCNT);
+	MODIFY_FIELD(CORTEXM7DWT->CTRL, DWT, CTRL, CYCCNTENA, DWT_CYCCNT_ENABLED);
+}
+
+uint32_t cycle_counter_get(void) {
+	return GET_REG(CORTEXM7DWT->CYCCNT);
+}
+
+uint32_t cycle_counter_elapsed(uint32_t start) {
+	return (cycle_counter_get() - start);
+}
@@ -0,0 +1,151 @@
+/**
+ * @copyright
+ * @file d3_acquisition.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief D3 domain autonomous acquisition functions
+ */
+
+#include <stddef.h>
+
+#include "registers/peripheral/rcc.h"
+#include "registers/peripheral/power.h"
+#include "registers/peripheral/exti.h"
+#include "registers/peripheral/bdma.h"
+#include "power/d3_acquisition.h"
+#include "clock/clock_gate.h"
+#include "boot/irq.h"
+#include "boot/sections.h"
+
+// Only channel 0 is used. DMAMUX2 channel 0 drives it
+#define D3_ACQUISITION_CHANNEL 0U
+
+// Data register of the BDMA is 16 bit wide
+#define D3_ACQUISITION_TRANSFERS_MAX 0xFFFFUL
+
+IRQ_DECLARE(BDMA_Channel0, IRQ_PRIORITY_LOWEST);
+
+// BDMA can only access SRAM4 and the D3 peripherals
+static uint32_t d3_acquisition_buffer[D3_ACQUISITION_BUFFER_SIZE / sizeof(uint32_t)] SRAM4_BSS;
+
+static d3_acquisition_callback d3_acquisition_notify;
+static uint32_t d3_acquisition_batch_samples;
+static uint32_t d3_acquisition_batch_bytes;
+static uint32_t d3_acquisition_autonomous;
+static volatile uint32_t d3_acquisition_batches;
+static bool d3_acquisition_running;
+static volatile bool d3_acquisition_failed;
+
+bool d3_acquisition_start(const d3_acquisition_config * config) {
+
+	if ((d3_acquisition_running == true) || (config->batch_samples == 0) || (config->batch_samples > (D3_ACQUISITION_TRANSFERS_MAX / 2UL))) {
+		return false;
+	}
+
+	const uint32_t batch_bytes = config->batch_samples << config->sample_size;
+	const uint32_t transfers = 2UL * config->batch_samples;
+
+	if ((2UL * batch_bytes) > D3_ACQUISITION_BUFFER_SIZE) {
+		return false;
+	}
+
+	d3_acquisition_notify = config->callback;
+	d3_acquisition_batch_samples = config->batch_samples;
+	d3_acquisition_batch_bytes = batch_bytes;
+	d3_acquisition_batches = 0;
+
+	// Autonomous mode keeps the clocks of the BDMA, SRAM4 and the peripheral running while the cores are in Stop mode. It also needs the low power enable bits
+	clock_gate_acquire(CLOCK_GATE(AHB4, BDMA), true);
+	d3_acquisition_autonomous = RCC_D3AMR_BDMAAMEN_MASK | RCC_D3AMR_SRAM4AMEN_MASK | config->autonomous_mask;
+	SET_BITS(RCC_COMMON->D3AMR, d3_acquisition_autonomous);
+
+	MODIFY_REG(DMAMUX2_COMMON->CCR[D3_ACQUISITION_CHANNEL], REGISTER_FIELD_SETTER(DMAMUX, CCR, DMAREQ_ID, config->request));
+
+	bdma_channel_regs * channel = &BDMA_COMMON->CHANNEL[D3_ACQUISITION_CHANNEL];
+	MODIFY_FIELD(channel->CCR, BDMA, CCR, EN, BDMA_CHANNEL_DISABLE);
+	MODIFY_REG(BDMA_COMMON->IFCR, (BDMA_ISR_GIF_MASK << BDMA_CHANNEL_FLAGS_SHIFT(D3_ACQUISITION_CHANNEL)));
+	MODIFY_REG(channel->CPAR, config->peripheral_address);
+	MODIFY_REG(channel->CM0AR, (uint32_t)d3_acquisition_buffer);
+	MODIFY_REG(channel->CNDTR, REGISTER_FIELD_SETTER(BDMA, CNDTR, NDT, transfers));
+
+	// Half transfer and transfer complete interrupts each mark the end of a batch
+	MODIFY_REG(channel->CCR,
+		REGISTER_FIELD_SETTER(BDMA, CCR, PL,    BDMA_PRIORITY_HIGH            ) |
+		REGISTER_FIELD_SETTER(BDMA, CCR, MSIZE, config->sample_size           ) |
+		REGISTER_FIELD_SETTER(BDMA, CCR, PSIZE, config->sample_size           ) |
+		REGISTER_FIELD_SETTER(BDMA, CCR, MINC,  BDMA_INCREMENT_ENABLE         ) |
+		REGISTER_FIELD_SETTER(BDMA, CCR, PINC,  BDMA_INCREMENT_DISABLE        ) |
+		REGISTER_FIELD_SETTER(BDMA, CCR, CIRC,  BDMA_CIRCULAR_ENABLE          ) |
+		REGISTER_FIELD_SETTER(BDMA, CCR, DIR,   BDMA_DIRECTION_FROMPERIPHERAL ) |
+		REGISTER_FIELD_SETTER(BDMA, CCR, TEIE,  BDMA_INT_ENABLE               ) |
+		REGISTER_FIELD_SETTER(BDMA, CCR, HTIE,  BDMA_INT_ENABLE               ) |
+		REGISTER_FIELD_SETTER(BDMA, CCR, TCIE,  BDMA_INT_ENABLE               ) );
+
+	// Channel interrupt wakes up CPU1 from Stop mode
+	SET_BITS(EXTI_COMMON->C1IMR3, EXTI_LINE_MASK(EXTI_LINE_BDMA_CH0));
+
+	// Domain D3 keeps running while CPU1 is in Stop mode
+	MODIFY_FIELD(PWR_COMMON->CPU1CR, PWR, CPU1CR, RUN_D3, PWR_D3RUNMODE_ALWAYSON);
+
+	d3_acquisition_running = true;
+
+	MODIFY_FIELD(channel->CCR, BDMA, CCR, EN, BDMA_CHANNEL_ENABLE);
+
+	return true;
+}
+
+void d3_acquisition_stop(void) {
+
+	if (d3_acquisition_running == false) {
+		return;
+	}
+
+	MODIFY_FIELD(BDMA_COMMON->CHANNEL[D3_ACQUISITION_CHANNEL].CCR, BDMA, CCR, EN, BDMA_CHANNEL_DISABLE);
+	MODIFY_REG(BDMA_COMMON->IFCR, (BDMA_ISR_GIF_MASK << BDMA_CHANNEL_FLAGS_SHIFT(D3_ACQUISITION_CHANNEL)));
+
+	MODIFY_FIELD(PWR_COMMON->CPU1CR, PWR, CPU1CR, RUN_D3, PWR_D3RUNMODE_FOLLOWSUBSYSMODE);
+	CLEAR_BITS(EXTI_COMMON->C1IMR3, EXTI_LINE_MASK(EXTI_LINE_BDMA_CH0));
+	CLEAR_BITS(RCC_COMMON->D3AMR, d3_acquisition_autonomous);
+	clock_gate_release(CLOCK_GATE(AHB4, BDMA), true);
+
+	d3_acquisition_running = false;
+	d3_acquisition_failed = false;
+}
+
+bool d3_acquisition_has_failed(void) {
+	return d3_acquisition_failed;
+}
+
+uint32_t d3_acquisition_get_batches(void) {
+	return d3_acquisition_batches;
+}
+
+void BDMA_Channel0_irq_handler(void) {
+
+	const uint32_t flags = GET_REG(BDMA_COMMON->ISR) >> BDMA_CHANNEL_FLAGS_SHIFT(D3_ACQUISITION_CHANNEL);
+	MODIFY_REG(BDMA_COMMON->IFCR, (BDMA_ISR_GIF_MASK << BDMA_CHANNEL_FLAGS_SHIFT(D3_ACQUISITION_CHANNEL)));
+
+	if ((flags & BDMA_ISR_TEIF_MASK) != 0) {
+		// Hardware disables the channel on a transfer error. Clock gates are released by d3_acquisition_stop from thread context
+		MODIFY_FIELD(BDMA_COMMON->CHANNEL[D3_ACQUISITION_CHANNEL].CCR, BDMA, CCR, EN, BDMA_CHANNEL_DISABLE);
+		d3_acquisition_failed = true;
+		return;
+	}
+
+	const uint8_t * buffer = (const uint8_t *)d3_acquisition_buffer;
+
+	if ((flags & BDMA_ISR_HTIF_MASK) != 0) {
+		d3_acquisition_batches++;
+		if (d3_acquisition_notify != NULL) {
+			d3_acquisition_notify(buffer, d3_acquisition_batch_samples);
+		}
+	}
+
+	if ((flags & BDMA_ISR_TCIF_MASK) != 0) {
+		d3_acquisition_batches++;
+		if (d3_acquisition_notify != NULL) {
+			d3_acquisition_notify((buffer + d3_acquisition_batch_bytes), d3_acquisition_batch_samples);
+		}
+	}
+
+}
@@ -0,0 +1,133 @@
+/**
+ * @copyright
+ * @file deferred_bss.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Deferred uninitialized data functions
+ */
+
+#include "registers/peripheral/mdma.h"
+#include "registers/peripheral/rcc.h"
+#include "boot/deferred_bss.h"
+#include "boot/sections.h"
+
+// Symbols defined in the linker script
+extern uint32_t _sbssdeferred;
+extern uint32_t _ebssdeferred;
+
+// The source of the transfer is accessed through the TCM bus hence it doesn't compete with the destination on the AXI bus
+static uint32_t deferred_bss_zero DTCM_BSS;
+
+static bool deferred_bss_started;
+static bool deferred_bss_completed;
+
+void deferred_bss_start(void) {
+
+	uint32_t start = (uint32_t)&_sbssdeferred;
+	uint32_t size = (uint32_t)&_ebssdeferred - start;
+
+	deferred_bss_started = true;
+
+	if (size == 0) {
+		deferred_bss_completed = true;
+		return;
+	}
+
+	mdma_channel_regs * channel = MDMA_CHANNEL(DEFERRED_BSS_MDMA_CHANNEL);
+
+	MODIFY_FIELD(RCC_COMMON->AHB3ENR, RCC, AHB3ENR, MDMAEN, RCC_PERIPHERALCLK_ENABLE);
+
+	// Channel can only be configured when it is disabled
+	MODIFY_FIELD(channel->CR, MDMA, CR, EN, MDMA_CHANNEL_DISABLE);
+
+	MODIFY_REG(channel->IFCR, (
+		REGISTER_FIELD_SETTER(MDMA, IFCR, CLTCIF, MDMA_INTFLAG_CLEAR ) |
+		REGISTER_FIELD_SETTER(MDMA, IFCR, CBTIF,  MDMA_INTFLAG_CLEAR ) |
+		REGISTER_FIELD_SETTER(MDMA, IFCR, CBRTIF, MDMA_INTFLAG_CLEAR ) |
+		REGISTER_FIELD_SETTER(MDMA, IFCR, CCTCIF, MDMA_INTFLAG_CLEAR ) |
+		REGISTER_FIELD_SETTER(MDMA, IFCR, CTEIF,  MDMA_INTFLAG_CLEAR ) )
+	);
+
+	// Source address is fixed and destination address is incremented.
+	// Writes are not bufferable so that the destination address register tracks the data actually written
+	MODIFY_REG(channel->TCR, (
+		REGISTER_FIELD_SETTER(MDMA, TCR, BWM,    MDMA_BUFFERABLEWRITE_DISABLE     ) |
+		REGISTER_FIELD_SETTER(MDMA, TCR, SWRM,   MDMA_REQUEST_SOFTWARE            ) |
+		REGISTER_FIELD_SETTER(MDMA, TCR, TRGM,   MDMA_TRIGGER_REPEATEDBLOCK       ) |
+		REGISTER_FIELD_SETTER(MDMA, TCR, PAM,    MDMA_ALIGNMENT_RIGHT             ) |
+		REGISTER_FIELD_SETTER(MDMA, TCR, TLEN,   (DEFERRED_BSS_BUFFER_LENGTH - 1) ) |
+		REGISTER_FIELD_SETTER(MDMA, TCR, DBURST, MDMA_BURST_16BEATS               ) |
+		REGISTER_FIELD_SETTER(MDMA, TCR, SBURST, MDMA_BURST_SINGLE                ) |
+		REGISTER_FIELD_SETTER(MDMA, TCR, DINCOS, MDMA_DATASIZE_WORD               ) |
+		REGISTER_FIELD_SETTER(MDMA, TCR, SINCOS, MDMA_DATASIZE_WORD               ) |
+		REGISTER_FIELD_SETTER(MDMA, TCR, DSIZE,  MDMA_DATASIZE_WORD               ) |
+		REGISTER_FIELD_SETTER(MDMA, TCR, SSIZE,  MDMA_DATASIZE_WORD               ) |
+		REGISTER_FIELD_SETTER(MDMA, TCR, DINC,   MDMA_ADDRESS_INCREMENT           ) |
+		REGISTER_FIELD_SETTER(MDMA, TCR, SINC,   MDMA_ADDRESS_FIXED               ) )
+	);
+
+	// The section is split into blocks of DEFERRED_BSS_BLOCK_SIZE bytes. The block counter is the number of repetitions hence it is decreased by 1
+	MODIFY_REG(channel->BNDTR, (
+		REGISTER_FIELD_SETTER(MDMA, BNDTR, BRC,   ((size / DEFERRED_BSS_BLOCK_SIZE) - 1) ) |
+		REGISTER_FIELD_SETTER(MDMA, BNDTR, BRDUM, MDMA_BLOCKREPEAT_ADDRINCREMENT        ) |
+		REGISTER_FIELD_SETTER(MDMA, BNDTR, BRSUM, MDMA_BLOCKREPEAT_ADDRINCREMENT        ) |
+		REGISTER_FIELD_SETTER(MDMA, BNDTR, BNDT,  DEFERRED_BSS_BLOCK_SIZE               ) )
+	);
+
+	CLEAR_REG(channel->BRUR);
+	CLEAR_REG(channel->LAR);
+	MODIFY_REG(channel->SAR, (uint32_t)&deferred_bss_zero);
+	MODIFY_REG(channel->DAR, start);
+
+	MODIFY_REG(channel->TBR, (
+		REGISTER_FIELD_SETTER(MDMA, TBR, DBUS, MDMA_BUS_AXI    ) |
+		REGISTER_FIELD_SETTER(MDMA, TBR, SBUS, MDMA_BUS_AHBTCM ) )
+	);
+
+	MODIFY_REG(channel->CR, (
+		REGISTER_FIELD_SETTER(MDMA, CR, PL, MDMA_PRIORITY_LOW   ) |
+		REGISTER_FIELD_SETTER(MDMA, CR, EN, MDMA_CHANNEL_ENABLE ) )
+	);
+
+	// A single software request transfers all blocks
+	MODIFY_FIELD(channel->CR, MDMA, CR, SWRQ, MDMA_SWREQUEST_ACTIVATE);
+}
+
+bool deferred_bss_is_ready(const void * buffer, uint32_t size) {
+
+	uint32_t start = (uint32_t)buffer;
+	uint32_t end = start + size;
+
+	// Buffers outside of the deferred section have been cleared by the startup code
+	if ((end <= (uint32_t)&_sbssdeferred) || (start >= (uint32_t)&_ebssdeferred)) {
+		return true;
+	}
+
+	if (deferred_bss_completed == true) {
+		return true;
+	}
+
+	if (deferred_bss_started == false) {
+		return false;
+	}
+
+	mdma_channel_regs * channel = MDMA_CHANNEL(DEFERRED_BSS_MDMA_CHANNEL);
+
+	if (GET_FIELD_VALUE(channel->ISR, MDMA, ISR, CTCIF) == MDMA_INTFLAG_SET) {
+		deferred_bss_completed = true;
+		return true;
+	}
+
+	// The MDMA fills the section from its lowest address upwards
+	return (GET_REG(channel->DAR) >= end);
+}
+
+void deferred_bss_wait(const void * buffer, uint32_t size) {
+	while (deferred_bss_is_ready(buffer, size) == false) {
+	}
+}
+
+void deferred_bss_wait_all(void) {
+	uint32_t start = (uint32_t)&_sbssdeferred;
+	deferred_bss_wait((const void *)start, ((uint32_t)&_ebssdeferred - start));
+}
@@ -0,0 +1,316 @@
+/**
+ * @copyright
+ * @file dvfs.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Dynamic voltage and frequency scaling (DVFS) functions
+ */
+
+#include <stddef.h>
+
+#include "registers/peripheral/rcc.h"
+#include "registers/peripheral/flash.h"
+#include "registers/peripheral/power.h"
+#include "registers/peripheral/syscfg.h"
+#include "clock/dvfs.h"
+#include "clock/clock_ready.h"
+#include "boot/boot.h"
+#include "utility/cycle_counter.h"
+
+#define DVFS_HZ_PER_MHZ 1000000UL
+#define DVFS_NS_PER_US 1000UL
+
+#ifdef SUPPLY_LDO
+// PLL1 VCO runs above 836 MHz, which is only allowed in VOS0
+#define DVFS_PLL1_SCALE DVFS_VOS0
+#else
+#define DVFS_PLL1_SCALE DVFS_VOS2
+#endif // SUPPLY_LDO
+
+// Flash wait states in VOS0
+static const dvfs_flash_wait_state flash_wait_states_vos0[] = {
+	{ .max_freq =  70000000UL, .latency = FLASH_LATENCY_0WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_0 },
+	{ .max_freq = 140000000UL, .latency = FLASH_LATENCY_1WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_1 },
+	{ .max_freq = 185000000UL, .latency = FLASH_LATENCY_2WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_1 },
+	{ .max_freq = 210000000UL, .latency = FLASH_LATENCY_2WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_2 },
+	{ .max_freq = 225000000UL, .latency = FLASH_LATENCY_3WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_2 },
+	{ .max_freq = 240000000UL, .latency = FLASH_LATENCY_4WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_2 }
+};
+
+// Flash wait states in VOS1
+static const dvfs_flash_wait_state flash_wait_states_vos1[] = {
+	{ .max_freq =  70000000UL, .latency = FLASH_LATENCY_0WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_0 },
+	{ .max_freq = 140000000UL, .latency = FLASH_LATENCY_1WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_1 },
+	{ .max_freq = 185000000UL, .latency = FLASH_LATENCY_2WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_1 },
+	{ .max_freq = 210000000UL, .latency = FLASH_LATENCY_2WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_2 },
+	{ .max_freq = 225000000UL, .latency = FLASH_LATENCY_3WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_2 }
+};
+
+// Flash wait states in VOS2
+static const dvfs_flash_wait_state flash_wait_states_vos2[] = {
+	{ .max_freq =  55000000UL, .latency = FLASH_LATENCY_0WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_0 },
+	{ .max_freq = 110000000UL, .latency = FLASH_LATENCY_1WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_1 },
+	{ .max_freq = 165000000UL, .latency = FLASH_LATENCY_2WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_1 },
+	{ .max_freq = 225000000UL, .latency = FLASH_LATENCY_3WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_2 }
+};
+
+// Flash wait states in VOS3
+static const dvfs_flash_wait_state flash_wait_states_vos3[] = {
+	{ .max_freq =  45000000UL, .latency = FLASH_LATENCY_0WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_0 },
+	{ .max_freq =  90000000UL, .latency = FLASH_LATENCY_1WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_1 },
+	{ .max_freq = 135000000UL, .latency = FLASH_LATENCY_2WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_1 },
+	{ .max_freq = 180000000UL, .latency = FLASH_LATENCY_3WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_2 },
+	{ .max_freq = 225000000UL, .latency = FLASH_LATENCY_4WAITSTATE, .wrhighfreq = FLASH_WRHIGHFREQ_2 }
+};
+
+// APB prescalers are left to the value set by the startup code (divide by 2)
+static const dvfs_profile_config dvfs_profiles[DVFS_PROFILE_NUMBER] = {
+	[DVFS_PROFILE_IDLE] = {
+		.name = "idle",
+		.sysclk = RCC_SYSCLK_HSI,
+		.core_prescaler = RCC_COREPRE_BYPASS,
+		.ahb_prescaler = RCC_AHBPRE_BYPASS,
+		.scale = DVFS_VOS3,
+		.pll1_on = false,
+		.core_freq = PLL_INPUT_FREQ,
+		.axi_freq = PLL_INPUT_FREQ
+	},
+	[DVFS_PROFILE_ACQUIRE] = {
+		.name = "acquire",
+		.sysclk = RCC_SYSCLK_PLL1,
+		.core_prescaler = RCC_COREPRE_DIV2,
+		.ahb_prescaler = RCC_AHBPRE_DIV2,
+		.scale = DVFS_PLL1_SCALE,
+		.pll1_on = true,
+		.core_freq = (BOOT_SYSCLK_FREQ / 2UL),
+		.axi_freq = (BOOT_AXI_FREQ / 2UL)
+	},
+	[DVFS_PROFILE_BURST] = {
+		.name = "burst",
+		.sysclk = RCC_SYSCLK_PLL1,
+		.core_prescaler = RCC_COREPRE_BYPASS,
+		.ahb_prescaler = RCC_AHBPRE_DIV2,
+#ifdef SUPPLY_LDO
+		.scale = DVFS_VOS0,
+#else
+		.scale = DVFS_VOS1,
+#endif // SUPPLY_LDO
+		.pll1_on = true,
+		.core_freq = BOOT_SYSCLK_FREQ,
+		.axi_freq = BOOT_AXI_FREQ
+	}
+};
+
+static dvfs_profile dvfs_current;
+static dvfs_notifier dvfs_notifiers[DVFS_NOTIFIERS_MAX];
+static uint32_t dvfs_notifiers_number;
+static uint32_t dvfs_transition_ns[DVFS_PROFILE_NUMBER][DVFS_PROFILE_NUMBER];
+
+const dvfs_flash_wait_state * dvfs_flash_wait_states_get(dvfs_voltage_scale scale, uint32_t axi_freq) {
+
+	const dvfs_flash_wait_state * table = flash_wait_states_vos3;
+	uint32_t entries = sizeof(flash_wait_states_vos3) / sizeof(dvfs_flash_wait_state);
+
+	switch (scale) {
+		case DVFS_VOS0:
+			table = flash_wait_states_vos0;
+			entries = sizeof(flash_wait_states_vos0) / sizeof(dvfs_flash_wait_state);
+			break;
+		case DVFS_VOS1:
+			table = flash_wait_states_vos1;
+			entries = sizeof(flash_wait_states_vos1) / sizeof(dvfs_flash_wait_state);
+			break;
+		case DVFS_VOS2:
+			table = flash_wait_states_vos2;
+			entries = sizeof(flash_wait_states_vos2) / sizeof(dvfs_flash_wait_state);
+			break;
+		default:
+			break;
+	}
+
+	for (uint32_t idx = 0; idx < entries; idx++) {
+		if (axi_freq <= table[idx].max_freq) {
+			return &table[idx];
+		}
+	}
+
+	return &table[entries - 1U];
+}
+
+void dvfs_flash_wait_states_set(dvfs_voltage_scale scale, uint32_t axi_freq) {
+
+	const dvfs_flash_wait_state * wait_states = dvfs_flash_wait_states_get(scale, axi_freq);
+
+	MODIFY_FIELD(FLASH_BANK1->ACR, FLASH, ACR, WRHIGHFREQ, wait_states->wrhighfreq);
+	MODIFY_FIELD(FLASH_BANK1->ACR, FLASH, ACR, LATENCY, wait_states->latency);
+
+}
+
+static void dvfs_voltage_scale_set(dvfs_voltage_scale scale) {
+
+	// Overdrive is turned off before leaving VOS0
+	if ((scale != DVFS_VOS0) && (GET_FIELD_VALUE(SYSCFG_COMMON->PWRCR, SYSCFG, PWRCR, ODEN) == SYSCFG_PWROVDR_ENABLE)) {
+		MODIFY_FIELD(SYSCFG_COMMON->PWRCR, SYSCFG, PWRCR, ODEN, SYSCFG_PWROVDR_DISABLE);
+		while (GET_FIELD_VALUE(PWR_COMMON->D3CR, PWR, D3CR, VOSRDY) != PWR_D3VOS_READY) {
+		}
+	}
+
+	uint32_t vos = PWR_D3VOS_SCALE3;
+	switch (scale) {
+		case DVFS_VOS0:
+		case DVFS_VOS1:
+			vos = PWR_D3VOS_SCALE1;
+			break;
+		case DVFS_VOS2:
+			vos = PWR_D3VOS_SCALE2;
+			break;
+		default:
+			break;
+	}
+
+	MODIFY_FIELD(PWR_COMMON->D3CR, PWR, D3CR, VOS, vos);
+	while (GET_FIELD_VALUE(PWR_COMMON->D3CR, PWR, D3CR, VOSRDY) != PWR_D3VOS_READY) {
+	}
+
+	// VOS0 is entered from VOS1 only
+	if (scale == DVFS_VOS0) {
+		MODIFY_FIELD(SYSCFG_COMMON->PWRCR, SYSCFG, PWRCR, ODEN, SYSCFG_PWROVDR_ENABLE);
+		while (GET_FIELD_VALUE(PWR_COMMON->D3CR, PWR, D3CR, VOSRDY) != PWR_D3VOS_READY) {
+		}
+	}
+
+}
+
+static void dvfs_notify(dvfs_event event, const dvfs_profile_config * from, const dvfs_profile_config * to) {
+	for (uint32_t idx = 0; idx < dvfs_notifiers_number; idx++) {
+		dvfs_notifiers[idx](event, from, to);
+	}
+}
+
+static uint32_t dvfs_cycles_to_ns(uint32_t cycles, uint32_t freq) {
+	// Split the conversion in order not to overflow 32 bits
+	const uint32_t mhz = freq / DVFS_HZ_PER_MHZ;
+	return ((cycles / mhz) * DVFS_NS_PER_US) + (((cycles % mhz) * DVFS_NS_PER_US) / mhz);
+}
+
+void dvfs_init(void) {
+	dvfs_current = DVFS_PROFILE_BURST;
+}
+
+bool dvfs_set_profile(dvfs_profile profile) {
+
+	if (profile >= DVFS_PROFILE_NUMBER) {
+		return false;
+	}
+
+	if (profile == dvfs_current) {
+		return true;
+	}
+
+	const dvfs_profile_config * from = &dvfs_profiles[dvfs_current];
+	const dvfs_profile_config * to = &dvfs_profiles[profile];
+	const dvfs_flash_wait_state * wait_states = dvfs_flash_wait_states_get(to->scale, to->axi_freq);
+
+	const uint32_t start = cycle_counter_get();
+
+	dvfs_notify(DVFS_EVENT_PRE_CHANGE, from, to);
+
+	// Voltage is raised before the clocks speed up
+	if (to->scale < from->scale) {
+		dvfs_voltage_scale_set(to->scale);
+	}
+
+	// PLL1 locks while flash latency is updated. The core sleeps until the ready interrupt fires
+	if ((to->pll1_on == true) && (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, PLL1ON) == RCC_PLL_DISABLE)) {
+		(void)clock_ready_start(CLOCK_READY_PLL1, NULL);
+	}
+
+	// Flash latency is increased before the clocks speed up
+	const bool latency_increase = (wait_states->latency > GET_FIELD_VALUE(FLASH_BANK1->ACR, FLASH, ACR, LATENCY));
+	if (latency_increase == true) {
+		dvfs_flash_wait_states_set(to->scale, to->axi_freq);
+	}
+
+	clock_ready_wait(CLOCK_READY_PLL1);
+
+	const uint32_t switch_start = cycle_counter_get();
+
+	if (to->sysclk == RCC_SYSCLK_HSI) {
+		// Switch first so that the prescalers are never bypassed while PLL1 is selected
+		MODIFY_FIELD(RCC_COMMON->CFGR, RCC, CFGR, SW, to->sysclk);
+		while (GET_FIELD_VALUE(RCC_COMMON->CFGR, RCC, CFGR, SWS) != to->sysclk) {
+		}
+		MODIFY_FIELD(RCC_COMMON->D1CFGR, RCC, D1CFGR, D1CPRE, to->core_prescaler);
+		MODIFY_FIELD(RCC_COMMON->D1CFGR, RCC, D1CFGR, HPRE, to->ahb_prescaler);
+	} else {
+		// Divide first so that the clocks never exceed the ones of either profile
+		MODIFY_FIELD(RCC_COMMON->D1CFGR, RCC, D1CFGR, D1CPRE, to->core_prescaler);
+		MODIFY_FIELD(RCC_COMMON->D1CFGR, RCC, D1CFGR, HPRE, to->ahb_prescaler);
+		MODIFY_FIELD(RCC_COMMON->CFGR, RCC, CFGR, SW, to->sysclk);
+		while (GET_FIELD_VALUE(RCC_COMMON->CFGR, RCC, CFGR, SWS) != to->sysclk) {
+		}
+	}
+
+	const uint32_t switch_end = cycle_counter_get();
+
+	// Flash latency is decreased after the clocks slow down
+	if (latency_increase == false) {
+		dvfs_flash_wait_states_set(to->scale, to->axi_freq);
+	}
+
+	if (to->pll1_on == false) {
+		CLEAR_BITS(RCC_COMMON->CR, REGISTER_FIELD_SETTER(RCC, CR, PLL1ON, RCC_PLL_ENABLE));
+	}
+
+	// Voltage is lowered after the clocks slow down
+	if (to->scale > from->scale) {
+		dvfs_voltage_scale_set(to->scale);
+	}
+
+	dvfs_notify(DVFS_EVENT_POST_CHANGE, from, to);
+
+	const uint32_t end = cycle_counter_get();
+
+	// Cycles up to the switch are counted at the frequency of the old profile and the following ones at the frequency of the new profile
+	// Core clock changes during the switch hence its cycles are converted at the lower frequency so that its duration is never underestimated
+	const uint32_t switch_freq = (from->core_freq < to->core_freq) ? from->core_freq : to->core_freq;
+	dvfs_transition_ns[dvfs_current][profile] = dvfs_cycles_to_ns((switch_start - start), from->core_freq) + dvfs_cycles_to_ns((switch_end - switch_start), switch_freq) + dvfs_cycles_to_ns((end - switch_end), to->core_freq);
+
+	dvfs_current = profile;
+
+	return true;
+}
+
+dvfs_profile dvfs_get_profile(void) {
+	return dvfs_current;
+}
+
+const dvfs_profile_config * dvfs_get_profile_config(dvfs_profile profile) {
+
+	if (profile >= DVFS_PROFILE_NUMBER) {
+		return NULL;
+	}
+
+	return &dvfs_profiles[profile];
+}
+
+bool dvfs_register_notifier(dvfs_notifier notifier) {
+
+	if (dvfs_notifiers_number >= DVFS_NOTIFIERS_MAX) {
+		return false;
+	}
+
+	dvfs_notifiers[dvfs_notifiers_number] = notifier;
+	dvfs_notifiers_number++;
+
+	return true;
+}
+
+uint32_t dvfs_get_transition_ns(dvfs_profile from, dvfs_profile to) {
+
+	if ((from >= DVFS_PROFILE_NUMBER) || (to >= DVFS_PROFILE_NUMBER)) {
+		return 0;
+	}
+
+	return dvfs_transition_ns[from][to];
+}
@@ -0,0 +1,40 @@
+/**
+ * @copyright
+ * @file dvfs_benchmark.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief DVFS benchmark functions
+ */
+
+#ifdef BENCHMARK
+
+#include "benchmark/dvfs_benchmark.h"
+
+dvfs_benchmark_result dvfs_benchmark;
+
+static void dvfs_benchmark_notifier(dvfs_event event, const dvfs_profile_config * from, const dvfs_profile_config * to) {
+	(void)event;
+	(void)from;
+	(void)to;
+	dvfs_benchmark.notifications++;
+}
+
+void dvfs_benchmark_run(void) {
+
+	(void)dvfs_register_notifier(dvfs_benchmark_notifier);
+
+	for (uint32_t from = 0; from < DVFS_PROFILE_NUMBER; from++) {
+		for (uint32_t to = 0; to < DVFS_PROFILE_NUMBER; to++) {
+			if (from != to) {
+				(void)dvfs_set_profile((dvfs_profile)from);
+				(void)dvfs_set_profile((dvfs_profile)to);
+				dvfs_benchmark.transition_ns[from][to] = dvfs_get_transition_ns((dvfs_profile)from, (dvfs_profile)to);
+			}
+		}
+	}
+
+	(void)dvfs_set_profile(DVFS_PROFILE_BURST);
+
+}
+
+#endif // BENCHMARK
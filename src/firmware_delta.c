@@ -0,0 +1,287 @@
+/**
+ * @copyright
+ * @file firmware_delta.c
+ * @author Andrea Gianarda
+ * @date 18th of October 2026
+ * @brief Firmware delta patch functions
+ */
+
+#include "boot/firmware_delta.h"
+#include "boot/firmware_update.h"
+#include "boot/image_crc.h"
+
+// End of the running image in flash. The checksum of the running image is the word stored at this address
+extern const uint32_t _eimage;
+
+// Unsigned LEB128 number of up to 32 bits spans at most 5 bytes
+#define FIRMWARE_DELTA_NUMBER_SHIFT_MAX 28U
+#define FIRMWARE_DELTA_NUMBER_CONTINUE 0x80U
+#define FIRMWARE_DELTA_NUMBER_VALUE 0x7FU
+#define FIRMWARE_DELTA_NUMBER_BITS 7U
+#define FIRMWARE_DELTA_NUMBER_OVERFLOW 0x70U
+
+#define FIRMWARE_DELTA_ARGUMENTS_MAX 2U
+
+/**
+ * @brief Decoder state
+ */
+typedef enum {
+	FIRMWARE_DELTA_STATE_HEADER,      /*!< Header is being received */
+	FIRMWARE_DELTA_STATE_OPCODE,      /*!< Next byte is an opcode */
+	FIRMWARE_DELTA_STATE_VALUE,       /*!< Next byte is the value of a fill command */
+	FIRMWARE_DELTA_STATE_ARGUMENT,    /*!< Next byte belongs to a number */
+	FIRMWARE_DELTA_STATE_COPY,        /*!< Bytes of the running image are being written */
+	FIRMWARE_DELTA_STATE_LITERAL,     /*!< Bytes of the patch are being written */
+	FIRMWARE_DELTA_STATE_FILL,        /*!< Repeated byte is being written */
+	FIRMWARE_DELTA_STATE_END          /*!< Whole new image has been produced and its last flash word has to be queued */
+} firmware_delta_state;
+
+static firmware_delta_status firmware_delta_result;
+static firmware_delta_state firmware_delta_decoder;
+
+static uint8_t firmware_delta_header[FIRMWARE_DELTA_HEADER_SIZE];
+static uint32_t firmware_delta_header_bytes;
+
+static uint32_t firmware_delta_opcode;
+static uint32_t firmware_delta_arguments[FIRMWARE_DELTA_ARGUMENTS_MAX];
+static uint32_t firmware_delta_argument_index;
+static uint32_t firmware_delta_argument_shift;
+static uint8_t firmware_delta_fill[FIRMWARE_DELTA_FILL_SIZE];
+
+// Size of the running image including its checksum and size of the new image
+static uint32_t firmware_delta_source_size;
+static uint32_t firmware_delta_target_size;
+// Bytes of the new image produced so far and bytes left in the current command
+static uint32_t firmware_delta_produced;
+static uint32_t firmware_delta_remaining;
+static uint32_t firmware_delta_source_offset;
+
+static uint32_t firmware_delta_word(uint32_t offset) {
+	return ((uint32_t)firmware_delta_header[offset]) | ((uint32_t)firmware_delta_header[offset + 1U] << 8) | ((uint32_t)firmware_delta_header[offset + 2U] << 16) | ((uint32_t)firmware_delta_header[offset + 3U] << 24);
+}
+
+static void firmware_delta_header_check(void) {
+
+	if (firmware_delta_word(0) != FIRMWARE_DELTA_MAGIC) {
+		firmware_delta_result = FIRMWARE_DELTA_STATUS_BAD_MAGIC;
+		return;
+	}
+
+	// Copy commands read the running image hence it must be the one the patch has been made from
+	if ((image_crc_get_status() != IMAGE_CRC_STATUS_VALID) || (firmware_delta_word(4) != _eimage)) {
+		firmware_delta_result = FIRMWARE_DELTA_STATUS_BASE_MISMATCH;
+		return;
+	}
+
+	firmware_delta_target_size = firmware_delta_word(8);
+	if ((firmware_delta_target_size == 0) || (firmware_delta_target_size > FIRMWARE_UPDATE_SIZE_MAX)) {
+		firmware_delta_result = FIRMWARE_DELTA_STATUS_CORRUPT;
+		return;
+	}
+
+	firmware_delta_decoder = FIRMWARE_DELTA_STATE_OPCODE;
+}
+
+// Start the command once all its arguments have been received
+static void firmware_delta_command_start(void) {
+
+	const uint32_t length = (firmware_delta_opcode == FIRMWARE_DELTA_OPCODE_COPY) ? firmware_delta_arguments[1] : firmware_delta_arguments[0];
+
+	if ((length == 0) || (length > (firmware_delta_target_size - firmware_delta_produced))) {
+		firmware_delta_result = FIRMWARE_DELTA_STATUS_CORRUPT;
+		return;
+	}
+
+	firmware_delta_remaining = length;
+
+	if (firmware_delta_opcode == FIRMWARE_DELTA_OPCODE_COPY) {
+		firmware_delta_source_offset = firmware_delta_arguments[0];
+		if ((firmware_delta_source_offset > firmware_delta_source_size) || (length > (firmware_delta_source_size - firmware_delta_source_offset))) {
+			firmware_delta_result = FIRMWARE_DELTA_STATUS_CORRUPT;
+			return;
+		}
+		firmware_delta_decoder = FIRMWARE_DELTA_STATE_COPY;
+	} else if (firmware_delta_opcode == FIRMWARE_DELTA_OPCODE_LITERAL) {
+		firmware_delta_decoder = FIRMWARE_DELTA_STATE_LITERAL;
+	} else {
+		firmware_delta_decoder = FIRMWARE_DELTA_STATE_FILL;
+	}
+}
+
+static void firmware_delta_opcode_decode(uint8_t opcode) {
+
+	firmware_delta_opcode = opcode;
+	firmware_delta_argument_index = 0;
+	firmware_delta_argument_shift = 0;
+	firmware_delta_arguments[0] = 0;
+	firmware_delta_arguments[1] = 0;
+
+	if (opcode == FIRMWARE_DELTA_OPCODE_FILL) {
+		firmware_delta_decoder = FIRMWARE_DELTA_STATE_VALUE;
+	} else if ((opcode == FIRMWARE_DELTA_OPCODE_COPY) || (opcode == FIRMWARE_DELTA_OPCODE_LITERAL)) {
+		firmware_delta_decoder = FIRMWARE_DELTA_STATE_ARGUMENT;
+	} else {
+		firmware_delta_result = FIRMWARE_DELTA_STATUS_CORRUPT;
+	}
+}
+
+static void firmware_delta_argument_decode(uint8_t byte) {
+
+	firmware_delta_arguments[firmware_delta_argument_index] |= ((uint32_t)(byte & FIRMWARE_DELTA_NUMBER_VALUE) << firmware_delta_argument_shift);
+
+	if ((byte & FIRMWARE_DELTA_NUMBER_CONTINUE) != 0) {
+		if (firmware_delta_argument_shift == FIRMWARE_DELTA_NUMBER_SHIFT_MAX) {
+			firmware_delta_result = FIRMWARE_DELTA_STATUS_CORRUPT;
+			return;
+		}
+		firmware_delta_argument_shift += FIRMWARE_DELTA_NUMBER_BITS;
+		return;
+	}
+
+	// Last byte of a 32-bit number only carries its 4 most significant bits
+	if ((firmware_delta_argument_shift == FIRMWARE_DELTA_NUMBER_SHIFT_MAX) && ((byte & FIRMWARE_DELTA_NUMBER_OVERFLOW) != 0)) {
+		firmware_delta_result = FIRMWARE_DELTA_STATUS_CORRUPT;
+		return;
+	}
+
+	firmware_delta_argument_shift = 0;
+	firmware_delta_argument_index++;
+
+	const uint32_t arguments = (firmware_delta_opcode == FIRMWARE_DELTA_OPCODE_COPY) ? 2U : 1U;
+	if (firmware_delta_argument_index == arguments) {
+		firmware_delta_command_start();
+	}
+}
+
+// Account for bytes of the new image accepted by the flash writer
+static void firmware_delta_output(uint32_t accepted) {
+
+	firmware_delta_produced += accepted;
+	firmware_delta_remaining -= accepted;
+
+	if (firmware_delta_remaining != 0) {
+		return;
+	}
+
+	firmware_delta_decoder = (firmware_delta_produced == firmware_delta_target_size) ? FIRMWARE_DELTA_STATE_END : FIRMWARE_DELTA_STATE_OPCODE;
+}
+
+// A firmware update that accepts no byte either has no room left in the flash writer or it has stopped receiving
+static bool firmware_delta_stalled(uint32_t accepted) {
+
+	if (accepted != 0) {
+		return false;
+	}
+
+	if (firmware_update_get_status() != FIRMWARE_UPDATE_STATUS_RECEIVING) {
+		firmware_delta_result = FIRMWARE_DELTA_STATUS_UPDATE_ERROR;
+	}
+
+	return true;
+}
+
+bool firmware_delta_begin(void) {
+
+	if (firmware_update_begin() == false) {
+		return false;
+	}
+
+	const uint32_t image_end = (uint32_t)&_eimage;
+
+	firmware_delta_source_size = image_end + sizeof(uint32_t) - IMAGE_CRC_BANK1_START;
+	firmware_delta_target_size = 0;
+	firmware_delta_produced = 0;
+	firmware_delta_remaining = 0;
+	firmware_delta_header_bytes = 0;
+	firmware_delta_decoder = FIRMWARE_DELTA_STATE_HEADER;
+	firmware_delta_result = FIRMWARE_DELTA_STATUS_APPLYING;
+
+	return true;
+}
+
+uint32_t firmware_delta_write(const void * data, uint32_t size) {
+
+	const uint8_t * bytes = (const uint8_t *)data;
+	uint32_t consumed = 0;
+	bool stalled = false;
+
+	while ((firmware_delta_result == FIRMWARE_DELTA_STATUS_APPLYING) && (stalled == false)) {
+
+		// Commands that do not read the patch keep running once the chunk has been consumed
+		const bool input_needed = (firmware_delta_decoder == FIRMWARE_DELTA_STATE_HEADER) || (firmware_delta_decoder == FIRMWARE_DELTA_STATE_OPCODE) ||
+		                          (firmware_delta_decoder == FIRMWARE_DELTA_STATE_VALUE) || (firmware_delta_decoder == FIRMWARE_DELTA_STATE_ARGUMENT) ||
+		                          (firmware_delta_decoder == FIRMWARE_DELTA_STATE_LITERAL);
+		if ((input_needed == true) && (consumed == size)) {
+			break;
+		}
+
+		switch (firmware_delta_decoder) {
+			case FIRMWARE_DELTA_STATE_HEADER:
+				firmware_delta_header[firmware_delta_header_bytes] = bytes[consumed];
+				firmware_delta_header_bytes++;
+				consumed++;
+				if (firmware_delta_header_bytes == FIRMWARE_DELTA_HEADER_SIZE) {
+					firmware_delta_header_check();
+				}
+				break;
+			case FIRMWARE_DELTA_STATE_OPCODE:
+				firmware_delta_opcode_decode(bytes[consumed]);
+				consumed++;
+				break;
+			case FIRMWARE_DELTA_STATE_VALUE:
+				for (uint32_t idx = 0; idx < FIRMWARE_DELTA_FILL_SIZE; idx++) {
+					firmware_delta_fill[idx] = bytes[consumed];
+				}
+				consumed++;
+				firmware_delta_decoder = FIRMWARE_DELTA_STATE_ARGUMENT;
+				break;
+			case FIRMWARE_DELTA_STATE_ARGUMENT:
+				firmware_delta_argument_decode(bytes[consumed]);
+				consumed++;
+				break;
+			case FIRMWARE_DELTA_STATE_COPY:
+			{
+				// Running image is read in place from the active bank
+				const uint8_t * source = (const uint8_t *)(IMAGE_CRC_BANK1_START + firmware_delta_source_offset);
+				const uint32_t accepted = firmware_update_write(source, firmware_delta_remaining);
+				stalled = firmware_delta_stalled(accepted);
+				firmware_delta_source_offset += accepted;
+				firmware_delta_output(accepted);
+				break;
+			}
+			case FIRMWARE_DELTA_STATE_LITERAL:
+			{
+				const uint32_t available = size - consumed;
+				const uint32_t chunk = (available < firmware_delta_remaining) ? available : firmware_delta_remaining;
+				const uint32_t accepted = firmware_update_write(&bytes[consumed], chunk);
+				stalled = firmware_delta_stalled(accepted);
+				consumed += accepted;
+				firmware_delta_output(accepted);
+				break;
+			}
+			case FIRMWARE_DELTA_STATE_FILL:
+			{
+				const uint32_t chunk = (firmware_delta_remaining < FIRMWARE_DELTA_FILL_SIZE) ? firmware_delta_remaining : FIRMWARE_DELTA_FILL_SIZE;
+				const uint32_t accepted = firmware_update_write(firmware_delta_fill, chunk);
+				stalled = firmware_delta_stalled(accepted);
+				firmware_delta_output(accepted);
+				break;
+			}
+			case FIRMWARE_DELTA_STATE_END:
+				stalled = (firmware_update_end() == false);
+				if (stalled == false) {
+					firmware_delta_result = FIRMWARE_DELTA_STATUS_COMPLETE;
+				}
+				break;
+			default:
+				firmware_delta_result = FIRMWARE_DELTA_STATUS_CORRUPT;
+				break;
+		}
+	}
+
+	return consumed;
+}
+
+firmware_delta_status firmware_delta_get_status(void) {
+	return firmware_delta_result;
+}
@@ -0,0 +1,162 @@
+/**
+ * @copyright
+ * @file firmware_update.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Firmware update functions
+ */
+
+#include "registers/cortexm7/scb.h"
+#include "registers/peripheral/flash.h"
+#include "boot/firmware_update.h"
+#include "boot/image_crc.h"
+
+static firmware_update_status firmware_update_result;
+static uint32_t firmware_update_size;
+
+bool firmware_update_begin(void) {
+
+	// Partial flash word of an aborted update is dropped
+	flash_writer_discard(FLASH_WRITER_STREAM_UPDATE);
+
+	if (flash_writer_open(FLASH_WRITER_STREAM_UPDATE, FIRMWARE_UPDATE_START, (FIRMWARE_UPDATE_START + FIRMWARE_UPDATE_SIZE_MAX)) == false) {
+		return false;
+	}
+
+	firmware_update_size = 0;
+	firmware_update_result = FIRMWARE_UPDATE_STATUS_RECEIVING;
+
+	return true;
+}
+
+uint32_t firmware_update_write(const void * data, uint32_t size) {
+
+	if (firmware_update_result != FIRMWARE_UPDATE_STATUS_RECEIVING) {
+		return 0;
+	}
+
+	const uint32_t accepted = flash_writer_write(FLASH_WRITER_STREAM_UPDATE, data, size);
+	firmware_update_size += accepted;
+
+	// Bytes beyond the largest image are rejected by the flash writer
+	if ((accepted < size) && (firmware_update_size == FIRMWARE_UPDATE_SIZE_MAX)) {
+		firmware_update_result = FIRMWARE_UPDATE_STATUS_WRITE_ERROR;
+	}
+
+	return accepted;
+}
+
+bool firmware_update_end(void) {
+
+	if (firmware_update_result != FIRMWARE_UPDATE_STATUS_RECEIVING) {
+		return true;
+	}
+
+	if (flash_writer_flush(FLASH_WRITER_STREAM_UPDATE) == false) {
+		return false;
+	}
+
+	firmware_update_result = FIRMWARE_UPDATE_STATUS_PROGRAMMING;
+
+	return true;
+}
+
+firmware_update_status firmware_update_verify(void) {
+
+	if (firmware_update_result != FIRMWARE_UPDATE_STATUS_PROGRAMMING) {
+		return firmware_update_result;
+	}
+
+	// CRC unit reads bank 2 hence no operation of any stream may run on it until the checksum has been computed
+	flash_writer_hold(true);
+	if (flash_writer_is_busy() == true) {
+		flash_writer_hold(false);
+		return firmware_update_result;
+	}
+
+	// Image is made of 32-bit words and it holds at least one word followed by its checksum
+	const bool size_valid = ((firmware_update_size >= (2U * sizeof(uint32_t))) && ((firmware_update_size % sizeof(uint32_t)) == 0));
+	if ((size_valid == false) || (flash_writer_get_stats(FLASH_WRITER_STREAM_UPDATE)->errors != 0)) {
+		flash_writer_hold(false);
+		firmware_update_result = FIRMWARE_UPDATE_STATUS_WRITE_ERROR;
+		return firmware_update_result;
+	}
+
+	const uint32_t checksum_offset = firmware_update_size - sizeof(uint32_t);
+	const uint32_t expected = *((const volatile uint32_t *)(FIRMWARE_UPDATE_START + checksum_offset));
+	uint32_t crc = 0;
+
+	// Checksum covers the image up to the word preceding the stored checksum as done by imageCrcStart at boot
+	image_crc_unit_start(FLASH_BANK2, 0, (checksum_offset - sizeof(uint32_t)));
+	if (image_crc_unit_wait(FLASH_BANK2, &crc) == false) {
+		firmware_update_result = FIRMWARE_UPDATE_STATUS_READ_ERROR;
+	} else if (crc == expected) {
+		firmware_update_result = FIRMWARE_UPDATE_STATUS_VALID;
+	} else {
+		firmware_update_result = FIRMWARE_UPDATE_STATUS_MISMATCH;
+	}
+
+	flash_writer_hold(false);
+
+	return firmware_update_result;
+}
+
+bool firmware_update_activate(void) {
+
+	if (firmware_update_result != FIRMWARE_UPDATE_STATUS_VALID) {
+		return false;
+	}
+
+	// Partial flash word of the log would be lost by the reset and option bytes cannot change while bank 2 is busy
+	while (flash_writer_flush(FLASH_WRITER_STREAM_LOG) == false) {
+	}
+	while (flash_writer_is_busy() == true) {
+	}
+
+	// Option control register is write protected until the key sequence is written. Option registers of bank 1 and bank 2 are the same
+	if (GET_FIELD_VALUE(FLASH_BANK1->OPTCR, FLASH, OPTCR, OPTLOCK) == FLASH_OPTLOCK_LOCKED) {
+		MODIFY_REG(FLASH_BANK1->OPTKEYR, FLASH_OPTKEY_KEY1);
+		MODIFY_REG(FLASH_BANK1->OPTKEYR, FLASH_OPTKEY_KEY2);
+	}
+
+	MODIFY_REG(FLASH_BANK1->OPTCCR, REGISTER_FIELD_SETTER(FLASH, OPTCCR, CLR_OPTBYTECHANGEERR, FLASH_OPTBYTECHANGEERR_CLR));
+
+	// Bank 2 is always the inactive bank hence the swap is toggled at every update
+	const uint32_t swap = (GET_FIELD_VALUE(FLASH_BANK1->OPTSR_CUR, FLASH, OPTSR_CUR, SWAP_BANKSOPT) == FLASH_SWAPBANKSOPT_ENABLE) ? FLASH_SWAPBANKSOPT_DISABLE : FLASH_SWAPBANKSOPT_ENABLE;
+	MODIFY_FIELD(FLASH_BANK1->OPTSR_PRG, FLASH, OPTSR_PRG, SWAP_BANKSOPT, swap);
+
+	MODIFY_FIELD(FLASH_BANK1->OPTCR, FLASH, OPTCR, OPTSTART, FLASH_OPTSTART_TRIGGER);
+	while (GET_FIELD_VALUE(FLASH_BANK1->OPTSR_CUR, FLASH, OPTSR_CUR, OPT_BUSY) == FLASH_OPTBYTE_OPONGOING) {
+	}
+
+	const bool failed = (GET_FIELD_VALUE(FLASH_BANK1->OPTSR_CUR, FLASH, OPTSR_CUR, OPTCHANGEERR) == FLASH_OPTBYTECHANGEERR_TRIGGERED);
+
+	MODIFY_FIELD(FLASH_BANK1->OPTCR, FLASH, OPTCR, OPTLOCK, FLASH_OPTLOCK_LOCKED);
+
+	if (failed == true) {
+		firmware_update_result = FIRMWARE_UPDATE_STATUS_SWAP_ERROR;
+		return false;
+	}
+
+	// Banks are swapped by the reset. It is a software reset hence the new image takes the warm boot path
+	__asm__ volatile ("dsb" : : : "memory");
+	MODIFY_REG(CORTEXM7SCB->AIRCR, (
+		REGISTER_FIELD_SETTER(SCB, AIRCR, VECTKEY,     SCB_VECKEY           ) |
+		(GET_REG(CORTEXM7SCB->AIRCR) & SCB_AIRCR_PRIGROUP_MASK)               |
+		REGISTER_FIELD_SETTER(SCB, AIRCR, SYSRESETREQ, SCB_SYSRESET_REQUEST ) )
+	);
+	__asm__ volatile ("dsb" : : : "memory");
+
+	while (1) {
+	}
+
+	return true;
+}
+
+firmware_update_status firmware_update_get_status(void) {
+	return firmware_update_result;
+}
+
+bool firmware_update_is_swapped(void) {
+	return (GET_FIELD_VALUE(FLASH_BANK1->OPTCR, FLASH, OPTCR, SWAP_BANKS) == FLASH_SWAPBANKS_ENABLED);
+}
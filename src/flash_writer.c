@@ -0,0 +1,354 @@
+/**
+ * @copyright
+ * @file flash_writer.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Flash writer functions
+ */
+
+#include <stddef.h>
+
+#include "registers/peripheral/flash.h"
+#include "storage/flash_writer.h"
+#include "boot/irq.h"
+#include "boot/sections.h"
+
+#define FLASH_WRITER_WORD_WORDS (FLASH_WRITER_WORD_SIZE / sizeof(uint32_t))
+#define FLASH_WRITER_ERASED 0xFFFFFFFFUL
+
+// Errors reported by program and erase operations. Bits have the same position in the status and clear control registers
+#define FLASH_WRITER_ERRORS (FLASH_SR_WRPERR_MASK | FLASH_SR_PGS_MASK | FLASH_SR_STRBERR_MASK | FLASH_SR_INCERR_MASK | FLASH_SR_OPERR_MASK)
+
+IRQ_DECLARE(FLASH, IRQ_PRIORITY_LOWEST);
+
+/**
+ * @brief Operation executed by bank 2
+ */
+typedef enum {
+	FLASH_WRITER_NONE,      /*!< Bank 2 is idle */
+	FLASH_WRITER_ERASE,     /*!< A sector is being erased */
+	FLASH_WRITER_PROGRAM    /*!< A flash word is being programmed */
+} flash_writer_operation;
+
+/**
+ * @brief State of a stream
+ */
+typedef struct {
+	uint32_t start;                                /*!< Address of the first byte */
+	uint32_t end;                                  /*!< Address following the last byte */
+	bool wrap;                                     /*!< Stream restarts from start once it reaches end */
+	uint32_t room;                                 /*!< Bytes that can still be accepted by a stream that does not wrap around */
+	uint32_t staging[FLASH_WRITER_WORD_WORDS];     /*!< Partial flash word */
+	uint32_t staging_bytes;                        /*!< Bytes in the partial flash word */
+	volatile uint32_t pending;                     /*!< Flash words queued and not programmed yet */
+	uint32_t address;                              /*!< Address of the next flash word to program */
+	uint32_t erased_sector;                        /*!< Start of the sector erased last or 0 */
+	flash_writer_stats statistics;                 /*!< Statistics */
+} flash_writer_stream_state;
+
+static uint32_t flash_writer_queue[FLASH_WRITER_QUEUE_WORDS][FLASH_WRITER_WORD_WORDS];
+static flash_writer_stream flash_writer_queue_stream[FLASH_WRITER_QUEUE_WORDS];
+// Free running counters of the flash words pushed and programmed
+static volatile uint32_t flash_writer_head;
+static volatile uint32_t flash_writer_tail;
+
+static volatile flash_writer_operation flash_writer_operation_ongoing;
+// No operation is started while bank 2 is held
+static volatile bool flash_writer_held;
+
+static flash_writer_stream_state flash_writer_streams[FLASH_WRITER_STREAM_NUMBER];
+
+static uint32_t ITCM_FUNC flash_writer_next(const flash_writer_stream_state * state, uint32_t size) {
+	const uint32_t address = state->address + size;
+	if (address < state->end) {
+		return address;
+	}
+	return (state->wrap == true) ? state->start : state->end;
+}
+
+// Start the next operation. It must be called with interrupts masked or from FLASH_irq_handler
+static void ITCM_FUNC flash_writer_kick(void) {
+
+	if ((flash_writer_held == true) || (flash_writer_operation_ongoing != FLASH_WRITER_NONE)) {
+		return;
+	}
+
+	flash_writer_stream_state * state = NULL;
+	while (flash_writer_head != flash_writer_tail) {
+		state = &flash_writer_streams[flash_writer_queue_stream[flash_writer_tail % FLASH_WRITER_QUEUE_WORDS]];
+		if (state->address != state->end) {
+			break;
+		}
+		// A failed erase moved a stream that does not wrap around past its end
+		state->statistics.errors++;
+		state->pending--;
+		flash_writer_tail++;
+		state = NULL;
+	}
+
+	if (state == NULL) {
+		return;
+	}
+
+	const uint32_t sector_start = state->address - (state->address % FLASH_WRITER_SECTOR_SIZE);
+
+	if ((state->address == sector_start) && (state->erased_sector != sector_start)) {
+		const uint32_t sector = (sector_start - FLASH_WRITER_BANK2_BASE) / FLASH_WRITER_SECTOR_SIZE;
+		flash_writer_operation_ongoing = FLASH_WRITER_ERASE;
+		MODIFY_FIELD(FLASH_BANK2->CR, FLASH, CR, SNB, sector);
+		MODIFY_FIELD(FLASH_BANK2->CR, FLASH, CR, SBER, FLASH_BANKSECERASEREQ_ENABLE);
+		MODIFY_FIELD(FLASH_BANK2->CR, FLASH, CR, START, FLASH_BANKSTART_ENABLE);
+		return;
+	}
+
+	const uint32_t * word = flash_writer_queue[flash_writer_tail % FLASH_WRITER_QUEUE_WORDS];
+	volatile uint32_t * flash = (volatile uint32_t *)state->address;
+
+	flash_writer_operation_ongoing = FLASH_WRITER_PROGRAM;
+	MODIFY_FIELD(FLASH_BANK2->CR, FLASH, CR, PG, FLASH_BANKINTBUF_ENABLE);
+
+	// Programming starts on its own once the write buffer holds a full flash word
+	for (uint32_t idx = 0; idx < FLASH_WRITER_WORD_WORDS; idx++) {
+		flash[idx] = word[idx];
+	}
+	__asm__ volatile ("dsb" : : : "memory");
+}
+
+static void flash_writer_start(void) {
+	__asm__ volatile ("cpsid i" : : : "memory");
+	flash_writer_kick();
+	__asm__ volatile ("cpsie i" : : : "memory");
+}
+
+// It must only be called when the queue is not full
+static void flash_writer_push(flash_writer_stream stream) {
+	flash_writer_stream_state * state = &flash_writer_streams[stream];
+	uint32_t * word = flash_writer_queue[flash_writer_head % FLASH_WRITER_QUEUE_WORDS];
+	for (uint32_t idx = 0; idx < FLASH_WRITER_WORD_WORDS; idx++) {
+		word[idx] = state->staging[idx];
+	}
+	flash_writer_queue_stream[flash_writer_head % FLASH_WRITER_QUEUE_WORDS] = stream;
+	state->staging_bytes = 0;
+
+	// The interrupt handler decrements the counter of programmed flash words
+	__asm__ volatile ("cpsid i" : : : "memory");
+	state->pending++;
+	__asm__ volatile ("cpsie i" : : : "memory");
+
+	flash_writer_head++;
+}
+
+static bool flash_writer_queue_full(void) {
+	return ((flash_writer_head - flash_writer_tail) == FLASH_WRITER_QUEUE_WORDS);
+}
+
+void flash_writer_init(void) {
+
+	if (GET_FIELD_VALUE(FLASH_BANK2->CR, FLASH, CR, LOCK) == FLASH_BANKCFG_LOCKED) {
+		MODIFY_REG(FLASH_BANK2->KEYR, FLASH_BANKKEY_KEY1);
+		MODIFY_REG(FLASH_BANK2->KEYR, FLASH_BANKKEY_KEY2);
+	}
+
+	MODIFY_REG(FLASH_BANK2->CCR, (FLASH_WRITER_ERRORS | FLASH_SR_EOP_MASK));
+
+	// Widest parallelism programs a flash word in the fewest steps. The board supplies the flash with 3.3V
+	MODIFY_FIELD(FLASH_BANK2->CR, FLASH, CR, PSIZE, FLASH_BANKPROGSIZE_DOUBLEWORDPAR);
+	SET_BITS(FLASH_BANK2->CR, (FLASH_CR_EOPIE_MASK | FLASH_CR_WRPERRIE_MASK | FLASH_CR_PGSIE_MASK | FLASH_CR_STRBERRIE_MASK | FLASH_CR_INCERRIE_MASK | FLASH_CR_OPERRIE_MASK));
+
+	flash_writer_stream_state * log = &flash_writer_streams[FLASH_WRITER_STREAM_LOG];
+	log->start = FLASH_WRITER_START;
+	log->end = FLASH_WRITER_END;
+	log->wrap = true;
+
+	// Log is written sequentially hence it ends at the first erased flash word
+	log->address = FLASH_WRITER_START;
+	for (uint32_t address = FLASH_WRITER_START; address < FLASH_WRITER_END; address += FLASH_WRITER_WORD_SIZE) {
+		const volatile uint32_t * flash = (const volatile uint32_t *)address;
+		bool erased = true;
+		for (uint32_t idx = 0; idx < FLASH_WRITER_WORD_WORDS; idx++) {
+			erased = erased && (flash[idx] == FLASH_WRITER_ERASED);
+		}
+		if (erased == true) {
+			log->address = address;
+			break;
+		}
+	}
+
+	// Remainder of the sector is erased unless the log stopped at a sector boundary
+	log->erased_sector = log->address - (log->address % FLASH_WRITER_SECTOR_SIZE);
+	if (log->address == log->erased_sector) {
+		log->erased_sector = 0;
+	}
+}
+
+bool flash_writer_open(flash_writer_stream stream, uint32_t start, uint32_t end) {
+
+	if ((stream >= FLASH_WRITER_STREAM_NUMBER) || (stream == FLASH_WRITER_STREAM_LOG)) {
+		return false;
+	}
+
+	flash_writer_stream_state * state = &flash_writer_streams[stream];
+
+	if ((state->pending != 0) || (state->staging_bytes != 0)) {
+		return false;
+	}
+
+	state->start = start;
+	state->end = end;
+	state->wrap = false;
+	state->room = end - start;
+	state->address = start;
+	state->erased_sector = 0;
+	state->statistics = (flash_writer_stats){ 0 };
+
+	return true;
+}
+
+uint32_t flash_writer_write(flash_writer_stream stream, const void * data, uint32_t size) {
+
+	if (stream >= FLASH_WRITER_STREAM_NUMBER) {
+		return 0;
+	}
+
+	flash_writer_stream_state * state = &flash_writer_streams[stream];
+	const uint8_t * bytes = (const uint8_t *)data;
+	uint8_t * staging = (uint8_t *)state->staging;
+	uint32_t accepted = 0;
+
+	while (accepted < size) {
+		// Streams share the queue hence another stream may have filled it while this one held a partial flash word
+		if ((state->staging_bytes == (FLASH_WRITER_WORD_SIZE - 1U)) && (flash_writer_queue_full() == true)) {
+			break;
+		}
+		if ((state->wrap == false) && (state->room == 0)) {
+			break;
+		}
+
+		staging[state->staging_bytes] = bytes[accepted];
+		state->staging_bytes++;
+		accepted++;
+		if (state->wrap == false) {
+			state->room--;
+		}
+
+		if (state->staging_bytes == FLASH_WRITER_WORD_SIZE) {
+			flash_writer_push(stream);
+		}
+	}
+
+	state->statistics.drops += (size - accepted);
+
+	flash_writer_start();
+
+	return accepted;
+}
+
+bool flash_writer_flush(flash_writer_stream stream) {
+
+	if (stream >= FLASH_WRITER_STREAM_NUMBER) {
+		return false;
+	}
+
+	flash_writer_stream_state * state = &flash_writer_streams[stream];
+
+	if (state->staging_bytes == 0) {
+		return true;
+	}
+
+	if (flash_writer_queue_full() == true) {
+		return false;
+	}
+
+	// Address ranges are made of whole sectors hence padding always fits
+	if (state->wrap == false) {
+		state->room -= (FLASH_WRITER_WORD_SIZE - state->staging_bytes);
+	}
+
+	uint8_t * staging = (uint8_t *)state->staging;
+	for (uint32_t idx = state->staging_bytes; idx < FLASH_WRITER_WORD_SIZE; idx++) {
+		staging[idx] = (uint8_t)FLASH_WRITER_ERASED;
+	}
+	flash_writer_push(stream);
+
+	flash_writer_start();
+
+	return true;
+}
+
+void flash_writer_discard(flash_writer_stream stream) {
+
+	if (stream >= FLASH_WRITER_STREAM_NUMBER) {
+		return;
+	}
+
+	flash_writer_stream_state * state = &flash_writer_streams[stream];
+
+	if (state->wrap == false) {
+		state->room += state->staging_bytes;
+	}
+	state->staging_bytes = 0;
+}
+
+void flash_writer_hold(bool hold) {
+
+	flash_writer_held = hold;
+
+	// Flash words queued while bank 2 was held are programmed now
+	if (hold == false) {
+		flash_writer_start();
+	}
+}
+
+bool flash_writer_is_busy(void) {
+	return ((flash_writer_operation_ongoing != FLASH_WRITER_NONE) || (flash_writer_head != flash_writer_tail));
+}
+
+bool flash_writer_is_pending(flash_writer_stream stream) {
+	return ((stream < FLASH_WRITER_STREAM_NUMBER) && (flash_writer_streams[stream].pending != 0));
+}
+
+const flash_writer_stats * flash_writer_get_stats(flash_writer_stream stream) {
+	return &flash_writer_streams[stream].statistics;
+}
+
+void ITCM_FUNC FLASH_irq_handler(void) {
+
+	const uint32_t status = GET_REG(FLASH_BANK2->SR) & (FLASH_WRITER_ERRORS | FLASH_SR_EOP_MASK);
+
+	if ((status == 0) || (flash_writer_operation_ongoing == FLASH_WRITER_NONE)) {
+		return;
+	}
+
+	MODIFY_REG(FLASH_BANK2->CCR, status);
+
+	// Operation ongoing always belongs to the flash word at the tail of the queue
+	flash_writer_stream_state * state = &flash_writer_streams[flash_writer_queue_stream[flash_writer_tail % FLASH_WRITER_QUEUE_WORDS]];
+
+	const bool failed = ((status & FLASH_WRITER_ERRORS) != 0);
+	if (failed == true) {
+		state->statistics.errors++;
+	}
+
+	if (flash_writer_operation_ongoing == FLASH_WRITER_ERASE) {
+		MODIFY_FIELD(FLASH_BANK2->CR, FLASH, CR, SBER, FLASH_BANKSECERASEREQ_DISABLE);
+		if (failed == true) {
+			// Sector cannot be programmed hence the stream moves to the next one
+			state->address = flash_writer_next(state, FLASH_WRITER_SECTOR_SIZE);
+		} else {
+			state->erased_sector = state->address;
+			state->statistics.erases++;
+		}
+	} else {
+		MODIFY_FIELD(FLASH_BANK2->CR, FLASH, CR, PG, FLASH_BANKINTBUF_DISABLE);
+		if (failed == false) {
+			state->statistics.words++;
+		}
+		state->pending--;
+		flash_writer_tail++;
+		state->address = flash_writer_next(state, FLASH_WRITER_WORD_SIZE);
+	}
+
+	flash_writer_operation_ongoing = FLASH_WRITER_NONE;
+
+	flash_writer_kick();
+}
@@ -0,0 +1,110 @@
+/**
+ * @copyright
+ * @file image_crc.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Firmware image verification functions
+ */
+
+#include "registers/peripheral/flash.h"
+#include "boot/image_crc.h"
+#include "boot/sections.h"
+#include "utility/cycle_counter.h"
+
+// End of the image in flash. The expected checksum is the word stored at this address
+extern const uint32_t _eimage;
+
+static image_crc_status image_crc_result;
+static uint32_t image_crc_wait_cycles;
+// Bank 2 stays unlocked while the flash writer uses it. It is written by systemInit before the uninitialized data sections are cleared
+static bool image_crc_unlocked NOINIT;
+
+void image_crc_unit_start(flash_bank_regs * bank, uint32_t start, uint32_t end) {
+
+	// Control register is write protected until the key sequence is written
+	image_crc_unlocked = (GET_FIELD_VALUE(bank->CR, FLASH, CR, LOCK) == FLASH_BANKCFG_LOCKED);
+	if (image_crc_unlocked == true) {
+		MODIFY_REG(bank->KEYR, FLASH_BANKKEY_KEY1);
+		MODIFY_REG(bank->KEYR, FLASH_BANKKEY_KEY2);
+	}
+
+	MODIFY_FIELD(bank->CR, FLASH, CR, CRCEN, FLASH_BANKCRC_ENABLE);
+
+	MODIFY_REG(bank->CRCSADDR, REGISTER_FIELD_SETTER(FLASH, CRCSADDR, CRC_START_ADDR, (start >> 2)));
+	MODIFY_REG(bank->CRCEADDR, REGISTER_FIELD_SETTER(FLASH, CRCEADDR, CRC_END_ADDR, (end >> 2)));
+
+	// Compute over the address range with the longest burst so that the unit holds the bank for as little time as possible
+	MODIFY_REG(bank->CRCCR, (
+		REGISTER_FIELD_SETTER(FLASH, CRCCR, ALL_BANK,    FLASH_CRCCALC_ALLADDR         ) |
+		REGISTER_FIELD_SETTER(FLASH, CRCCR, CRC_BURST,   FLASH_BURSTSIZE_256FLASHWORDS ) |
+		REGISTER_FIELD_SETTER(FLASH, CRCCR, CLEAN_CRC,   FLASH_CLRRESULT_CLEAR         ) |
+		REGISTER_FIELD_SETTER(FLASH, CRCCR, CRC_BY_SECT, FLASH_CRCCALC_ALLADDR         ) )
+	);
+
+	MODIFY_FIELD(bank->CRCCR, FLASH, CRCCR, START_CRC, FLASH_STARTCALC_TRIGGER);
+
+}
+
+bool image_crc_unit_wait(flash_bank_regs * bank, uint32_t * crc) {
+
+	while (GET_FIELD_VALUE(bank->SR, FLASH, SR, CRCEND) != FLASH_BANKCRCEND_CRCCALCULATED) {
+		if (GET_FIELD_VALUE(bank->SR, FLASH, SR, CRCRDERR) == FLASH_BANKCRCRDERR_DETECTED) {
+			break;
+		}
+	}
+
+	const bool read_error = (GET_FIELD_VALUE(bank->SR, FLASH, SR, CRCRDERR) == FLASH_BANKCRCRDERR_DETECTED);
+
+	*crc = GET_REG(bank->CRCDATAR);
+
+	// Flags are cleared by writing 1 to the clear register
+	MODIFY_REG(bank->CCR, (
+		REGISTER_FIELD_SETTER(FLASH, CCR, CLR_CRCEND,   FLASH_BANKCRCEND_CLR   ) |
+		REGISTER_FIELD_SETTER(FLASH, CCR, CLR_CRCRDERR, FLASH_BANKCRCRDERR_CLR ) )
+	);
+
+	MODIFY_FIELD(bank->CR, FLASH, CR, CRCEN, FLASH_BANKCRC_DISABLE);
+	if (image_crc_unlocked == true) {
+		MODIFY_FIELD(bank->CR, FLASH, CR, LOCK, FLASH_BANKCFG_LOCKED);
+	}
+
+	return (read_error == false);
+}
+
+void imageCrcStart(void) {
+
+	const uint32_t image_end = (uint32_t)&_eimage;
+
+	// The image starts at the beginning of bank 1 and the last word covered by the checksum is right before it
+	image_crc_unit_start(FLASH_BANK1, 0, (image_end - IMAGE_CRC_BANK1_START - sizeof(uint32_t)));
+
+}
+
+image_crc_status image_crc_check(void) {
+
+	uint32_t crc = 0;
+
+	const uint32_t start = cycle_counter_get();
+	const bool completed = image_crc_unit_wait(FLASH_BANK1, &crc);
+	image_crc_wait_cycles = cycle_counter_elapsed(start);
+
+	if (completed == false) {
+		image_crc_result = IMAGE_CRC_STATUS_READ_ERROR;
+	} else if (_eimage == IMAGE_CRC_NOT_STORED) {
+		image_crc_result = IMAGE_CRC_STATUS_NOT_STORED;
+	} else if (crc == _eimage) {
+		image_crc_result = IMAGE_CRC_STATUS_VALID;
+	} else {
+		image_crc_result = IMAGE_CRC_STATUS_MISMATCH;
+	}
+
+	return image_crc_result;
+}
+
+image_crc_status image_crc_get_status(void) {
+	return image_crc_result;
+}
+
+uint32_t image_crc_get_wait_cycles(void) {
+	return image_crc_wait_cycles;
+}
@@ -0,0 +1,28 @@
+/**
+ * @copyright
+ * @file irq.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Interrupt ownership functions
+ */
+
+#include "registers/cortexm7/nvic.h"
+#include "boot/irq.h"
+
+// Start and end address of the interrupt configuration table from the linker script
+extern const irq_config _sirqconfig[];
+extern const irq_config _eirqconfig[];
+
+void irq_config_apply(void) {
+
+	for (const irq_config * config = _sirqconfig; config < _eirqconfig; config++) {
+		const uint32_t irq = (uint32_t)config->irq;
+
+		// Unimplemented low order bits of the priority byte are ignored by the NVIC
+		CORTEXM7NVIC->IPR[irq] = (uint8_t)(config->priority << (8U - IRQ_PRIORITY_BITS));
+
+		// Writing 0 to other bits of the set enable register has no effect
+		MODIFY_REG(CORTEXM7NVIC->ISER[irq / 32U], (0x1UL << (irq % 32U)));
+	}
+
+}
@@ -0,0 +1,102 @@
+/**
+ * @copyright
+ * @file itcm_benchmark.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief ITCM benchmark functions
+ */
+
+#ifdef BENCHMARK
+
+#include "benchmark/itcm_benchmark.h"
+#include "boot/sections.h"
+#include "utility/cycle_counter.h"
+
+// Number of entries of the ring buffer written by the interrupt handler body. It must be a power of 2
+#define ITCM_BENCHMARK_RING_SIZE 64U
+
+itcm_benchmark_result itcm_benchmark;
+
+// Filter coefficients in Q15 format. They are read from the DTCM
+static const int16_t fir_coefficients[ITCM_BENCHMARK_FIR_TAPS] DTCM_RODATA = {
+	  -47,   -86,  -118,  -109,   -21,   168,   445,   757,
+	 1017,  1123,   984,   541,  -210,  -1178, -2164, -2901,
+	 3122,  2901,  2164,  1178,   210,  -541,  -984, -1123,
+	-1017,  -757,  -445,  -168,    21,   109,   118,    86
+};
+
+static int16_t fir_input[ITCM_BENCHMARK_FIR_SAMPLES + ITCM_BENCHMARK_FIR_TAPS] DTCM_BSS;
+static int32_t fir_output[ITCM_BENCHMARK_FIR_SAMPLES] DTCM_BSS;
+
+static uint32_t ring[ITCM_BENCHMARK_RING_SIZE] DTCM_BSS;
+static uint32_t ring_head DTCM_BSS;
+static uint32_t ring_overflows DTCM_BSS;
+
+// Bodies are inlined in both the flash and the ITCM versions so that the generated code is the same
+static inline __attribute__((always_inline)) void isr_body(uint32_t value) {
+	const uint32_t next = (ring_head + 1U) & (ITCM_BENCHMARK_RING_SIZE - 1U);
+	if (next == 0U) {
+		ring_overflows++;
+	}
+	ring[ring_head] = value ^ (value >> 7);
+	ring_head = next;
+}
+
+static inline __attribute__((always_inline)) void fir_body(void) {
+	for (uint32_t sample = 0; sample < ITCM_BENCHMARK_FIR_SAMPLES; sample++) {
+		int32_t acc = 0;
+		for (uint32_t tap = 0; tap < ITCM_BENCHMARK_FIR_TAPS; tap++) {
+			acc += (int32_t)fir_input[sample + tap] * (int32_t)fir_coefficients[tap];
+		}
+		fir_output[sample] = acc >> 15;
+	}
+}
+
+static void __attribute__((noinline)) isr_flash(uint32_t value) {
+	isr_body(value);
+}
+
+static void ITCM_FUNC isr_itcm(uint32_t value) {
+	isr_body(value);
+}
+
+static void __attribute__((noinline)) fir_flash(void) {
+	fir_body();
+}
+
+static void ITCM_FUNC fir_itcm(void) {
+	fir_body();
+}
+
+void itcm_benchmark_run(void) {
+
+	uint32_t start = 0;
+
+	for (uint32_t idx = 0; idx < (ITCM_BENCHMARK_FIR_SAMPLES + ITCM_BENCHMARK_FIR_TAPS); idx++) {
+		// Sawtooth input signal
+		fir_input[idx] = (int16_t)((idx * 997U) & 0x7FFFU);
+	}
+
+	start = cycle_counter_get();
+	for (uint32_t call = 0; call < ITCM_BENCHMARK_ISR_CALLS; call++) {
+		isr_flash(call);
+	}
+	itcm_benchmark.isr_flash = cycle_counter_elapsed(start);
+
+	start = cycle_counter_get();
+	for (uint32_t call = 0; call < ITCM_BENCHMARK_ISR_CALLS; call++) {
+		isr_itcm(call);
+	}
+	itcm_benchmark.isr_itcm = cycle_counter_elapsed(start);
+
+	start = cycle_counter_get();
+	fir_flash();
+	itcm_benchmark.fir_flash = cycle_counter_elapsed(start);
+
+	start = cycle_counter_get();
+	fir_itcm();
+	itcm_benchmark.fir_itcm = cycle_counter_elapsed(start);
+
+}
+
+#endif // BENCHMARK
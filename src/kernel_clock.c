@@ -0,0 +1,114 @@
+/**
+ * @copyright
+ * @file kernel_clock.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Kernel clock routing functions
+ */
+
+#include "registers/peripheral/rcc.h"
+#include "clock/kernel_clock.h"
+
+// Kernel clock selection registers
+#define KERNEL_CLOCK_D1CCIPR 0U
+#define KERNEL_CLOCK_D2CCIP1R 1U
+#define KERNEL_CLOCK_D2CCIP2R 2U
+#define KERNEL_CLOCK_D3CCIPR 3U
+
+#define KERNEL_CLOCK_NUMBER (CLOCK_TREE_CLOCK_NUMBER - CLOCK_TREE_KERNEL_FIRST)
+
+// Kernel clock selection field and sources indexed by the value of the field
+typedef struct {
+	uint32_t reg;
+	uint32_t offset;
+	uint32_t mask;
+	clock_tree_clock sources[KERNEL_CLOCK_SOURCES_MAX];
+} kernel_clock_mux;
+
+// Sources of disabled clocks and reserved selections are not listed hence they are CLOCK_TREE_NONE
+static const kernel_clock_mux kernel_clock_muxes[KERNEL_CLOCK_NUMBER] = {
+	[CLOCK_TREE_USART16 - CLOCK_TREE_KERNEL_FIRST]    = { KERNEL_CLOCK_D2CCIP2R, RCC_D2CCIP2R_USART16SEL_OFFSET,     RCC_D2CCIP2R_USART16SEL_MASK,     { CLOCK_TREE_PCLK2, CLOCK_TREE_PLL2Q, CLOCK_TREE_PLL3Q, CLOCK_TREE_HSI, CLOCK_TREE_CSI, CLOCK_TREE_LSE } },
+	[CLOCK_TREE_USART234578 - CLOCK_TREE_KERNEL_FIRST] = { KERNEL_CLOCK_D2CCIP2R, RCC_D2CCIP2R_USART234578SEL_OFFSET, RCC_D2CCIP2R_USART234578SEL_MASK, { CLOCK_TREE_PCLK1, CLOCK_TREE_PLL2Q, CLOCK_TREE_PLL3Q, CLOCK_TREE_HSI, CLOCK_TREE_CSI, CLOCK_TREE_LSE } },
+	[CLOCK_TREE_LPUART1 - CLOCK_TREE_KERNEL_FIRST]    = { KERNEL_CLOCK_D3CCIPR,  RCC_D3CCIPR_LPUART1SEL_OFFSET,      RCC_D3CCIPR_LPUART1SEL_MASK,      { CLOCK_TREE_PCLK4, CLOCK_TREE_PLL2Q, CLOCK_TREE_PLL3Q, CLOCK_TREE_HSI, CLOCK_TREE_CSI, CLOCK_TREE_LSE } },
+	[CLOCK_TREE_I2C123 - CLOCK_TREE_KERNEL_FIRST]     = { KERNEL_CLOCK_D2CCIP2R, RCC_D2CCIP2R_I2C123SEL_OFFSET,      RCC_D2CCIP2R_I2C123SEL_MASK,      { CLOCK_TREE_PCLK1, CLOCK_TREE_PLL3R, CLOCK_TREE_HSI, CLOCK_TREE_CSI } },
+	[CLOCK_TREE_I2C4 - CLOCK_TREE_KERNEL_FIRST]       = { KERNEL_CLOCK_D3CCIPR,  RCC_D3CCIPR_I2C4SEL_OFFSET,         RCC_D3CCIPR_I2C4SEL_MASK,         { CLOCK_TREE_PCLK4, CLOCK_TREE_PLL3R, CLOCK_TREE_HSI, CLOCK_TREE_CSI } },
+	[CLOCK_TREE_SPI123 - CLOCK_TREE_KERNEL_FIRST]     = { KERNEL_CLOCK_D2CCIP1R, RCC_D2CCIP1R_SPI123SEL_OFFSET,      RCC_D2CCIP1R_SPI123SEL_MASK,      { CLOCK_TREE_PLL1Q, CLOCK_TREE_PLL2P, CLOCK_TREE_PLL3P, CLOCK_TREE_NONE, CLOCK_TREE_PER } },
+	[CLOCK_TREE_SPI45 - CLOCK_TREE_KERNEL_FIRST]      = { KERNEL_CLOCK_D2CCIP1R, RCC_D2CCIP1R_SPI45SEL_OFFSET,       RCC_D2CCIP1R_SPI45SEL_MASK,       { CLOCK_TREE_PCLK2, CLOCK_TREE_PLL2Q, CLOCK_TREE_PLL3Q, CLOCK_TREE_HSI, CLOCK_TREE_CSI, CLOCK_TREE_HSE } },
+	[CLOCK_TREE_SPI6 - CLOCK_TREE_KERNEL_FIRST]       = { KERNEL_CLOCK_D3CCIPR,  RCC_D3CCIPR_SPI6SEL_OFFSET,         RCC_D3CCIPR_SPI6SEL_MASK,         { CLOCK_TREE_PCLK4, CLOCK_TREE_PLL2Q, CLOCK_TREE_PLL3Q, CLOCK_TREE_HSI, CLOCK_TREE_CSI, CLOCK_TREE_HSE } },
+	[CLOCK_TREE_QSPI - CLOCK_TREE_KERNEL_FIRST]       = { KERNEL_CLOCK_D1CCIPR,  RCC_D1CCIPR_QSPISEL_OFFSET,         RCC_D1CCIPR_QSPISEL_MASK,         { CLOCK_TREE_HCLK, CLOCK_TREE_PLL1Q, CLOCK_TREE_PLL2R, CLOCK_TREE_PER } },
+	[CLOCK_TREE_FMC - CLOCK_TREE_KERNEL_FIRST]        = { KERNEL_CLOCK_D1CCIPR,  RCC_D1CCIPR_FMCSEL_OFFSET,          RCC_D1CCIPR_FMCSEL_MASK,          { CLOCK_TREE_HCLK, CLOCK_TREE_PLL1Q, CLOCK_TREE_PLL2R, CLOCK_TREE_PER } },
+	[CLOCK_TREE_SDMMC - CLOCK_TREE_KERNEL_FIRST]      = { KERNEL_CLOCK_D1CCIPR,  RCC_D1CCIPR_SDMMCSEL_OFFSET,        RCC_D1CCIPR_SDMMCSEL_MASK,        { CLOCK_TREE_PLL1Q, CLOCK_TREE_PLL2R } },
+	[CLOCK_TREE_FDCAN - CLOCK_TREE_KERNEL_FIRST]      = { KERNEL_CLOCK_D2CCIP1R, RCC_D2CCIP1R_FDCANSEL_OFFSET,       RCC_D2CCIP1R_FDCANSEL_MASK,       { CLOCK_TREE_HSE, CLOCK_TREE_PLL1Q, CLOCK_TREE_PLL2Q } },
+	[CLOCK_TREE_RNG - CLOCK_TREE_KERNEL_FIRST]        = { KERNEL_CLOCK_D2CCIP2R, RCC_D2CCIP2R_RNGSEL_OFFSET,         RCC_D2CCIP2R_RNGSEL_MASK,         { CLOCK_TREE_HSI48, CLOCK_TREE_PLL1Q, CLOCK_TREE_LSE, CLOCK_TREE_LSI } },
+	[CLOCK_TREE_USB - CLOCK_TREE_KERNEL_FIRST]        = { KERNEL_CLOCK_D2CCIP2R, RCC_D2CCIP2R_USBSEL_OFFSET,         RCC_D2CCIP2R_USBSEL_MASK,         { CLOCK_TREE_NONE, CLOCK_TREE_PLL1Q, CLOCK_TREE_PLL3Q, CLOCK_TREE_HSI48 } },
+	[CLOCK_TREE_ADC - CLOCK_TREE_KERNEL_FIRST]        = { KERNEL_CLOCK_D3CCIPR,  RCC_D3CCIPR_ADCSEL_OFFSET,          RCC_D3CCIPR_ADCSEL_MASK,          { CLOCK_TREE_PLL2P, CLOCK_TREE_PLL3R, CLOCK_TREE_PER } },
+	[CLOCK_TREE_LPTIM1 - CLOCK_TREE_KERNEL_FIRST]     = { KERNEL_CLOCK_D2CCIP2R, RCC_D2CCIP2R_LPTIM1SEL_OFFSET,      RCC_D2CCIP2R_LPTIM1SEL_MASK,      { CLOCK_TREE_PCLK1, CLOCK_TREE_PLL2P, CLOCK_TREE_PLL3R, CLOCK_TREE_LSE, CLOCK_TREE_LSI, CLOCK_TREE_PER } },
+	[CLOCK_TREE_LPTIM2 - CLOCK_TREE_KERNEL_FIRST]     = { KERNEL_CLOCK_D3CCIPR,  RCC_D3CCIPR_LPTIM2SEL_OFFSET,       RCC_D3CCIPR_LPTIM2SEL_MASK,       { CLOCK_TREE_PCLK4, CLOCK_TREE_PLL2P, CLOCK_TREE_PLL3R, CLOCK_TREE_LSE, CLOCK_TREE_LSI, CLOCK_TREE_PER } },
+	[CLOCK_TREE_LPTIM345 - CLOCK_TREE_KERNEL_FIRST]   = { KERNEL_CLOCK_D3CCIPR,  RCC_D3CCIPR_LPTIM345SEL_OFFSET,     RCC_D3CCIPR_LPTIM345SEL_MASK,     { CLOCK_TREE_PCLK4, CLOCK_TREE_PLL2P, CLOCK_TREE_PLL3R, CLOCK_TREE_LSE, CLOCK_TREE_LSI, CLOCK_TREE_PER } }
+};
+
+// Default routing: PLL2 and PLL3 are not affected by DVFS
+// ADC divides its kernel clock further with the prescaler of the ADC common registers
+static const kernel_clock_route kernel_clock_routing[] = {
+	{ .kernel = CLOCK_TREE_USART16,     .source = CLOCK_TREE_PLL3Q },
+	{ .kernel = CLOCK_TREE_USART234578, .source = CLOCK_TREE_PLL3Q },
+	{ .kernel = CLOCK_TREE_LPUART1,     .source = CLOCK_TREE_PLL3Q },
+	{ .kernel = CLOCK_TREE_I2C123,      .source = CLOCK_TREE_PLL3R },
+	{ .kernel = CLOCK_TREE_I2C4,        .source = CLOCK_TREE_PLL3R },
+	{ .kernel = CLOCK_TREE_SPI123,      .source = CLOCK_TREE_PLL2P },
+	{ .kernel = CLOCK_TREE_SPI45,       .source = CLOCK_TREE_PLL2Q },
+	{ .kernel = CLOCK_TREE_SPI6,        .source = CLOCK_TREE_PLL2Q },
+	{ .kernel = CLOCK_TREE_ADC,         .source = CLOCK_TREE_PLL2P },
+	{ .kernel = CLOCK_TREE_SDMMC,       .source = CLOCK_TREE_PLL2R }
+};
+
+static volatile uint32_t * kernel_clock_get_reg(uint32_t reg) {
+	switch (reg) {
+		case KERNEL_CLOCK_D1CCIPR:
+			return &RCC_COMMON->D1CCIPR;
+		case KERNEL_CLOCK_D2CCIP1R:
+			return &RCC_COMMON->D2CCIP1R;
+		case KERNEL_CLOCK_D2CCIP2R:
+			return &RCC_COMMON->D2CCIP2R;
+		default:
+			return &RCC_COMMON->D3CCIPR;
+	}
+}
+
+void kernel_clock_init(void) {
+	for (uint32_t idx = 0; idx < (sizeof(kernel_clock_routing) / sizeof(kernel_clock_route)); idx++) {
+		(void)kernel_clock_set_source(kernel_clock_routing[idx].kernel, kernel_clock_routing[idx].source);
+	}
+}
+
+bool kernel_clock_set_source(clock_tree_clock kernel, clock_tree_clock source) {
+
+	if ((kernel < CLOCK_TREE_KERNEL_FIRST) || (kernel >= CLOCK_TREE_CLOCK_NUMBER) || (source == CLOCK_TREE_NONE)) {
+		return false;
+	}
+
+	const kernel_clock_mux * mux = &kernel_clock_muxes[kernel - CLOCK_TREE_KERNEL_FIRST];
+
+	for (uint32_t sel = 0; sel < KERNEL_CLOCK_SOURCES_MAX; sel++) {
+		if (mux->sources[sel] == source) {
+			volatile uint32_t * reg = kernel_clock_get_reg(mux->reg);
+			MODIFY_FIELD_WITH_MASK(*reg, mux->mask, (sel << mux->offset));
+			clock_tree_invalidate();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+clock_tree_clock kernel_clock_get_source(clock_tree_clock kernel) {
+
+	if ((kernel < CLOCK_TREE_KERNEL_FIRST) || (kernel >= CLOCK_TREE_CLOCK_NUMBER)) {
+		return CLOCK_TREE_NONE;
+	}
+
+	const kernel_clock_mux * mux = &kernel_clock_muxes[kernel - CLOCK_TREE_KERNEL_FIRST];
+	const uint32_t sel = (GET_REG(*kernel_clock_get_reg(mux->reg)) & mux->mask) >> mux->offset;
+
+	return (sel < KERNEL_CLOCK_SOURCES_MAX) ? mux->sources[sel] : CLOCK_TREE_NONE;
+}
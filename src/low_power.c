@@ -0,0 +1,232 @@
+/**
+ * @copyright
+ * @file low_power.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Low power manager functions
+ */
+
+#include <stddef.h>
+
+#include "registers/peripheral/rcc.h"
+#include "registers/peripheral/power.h"
+#include "registers/peripheral/rtc.h"
+#include "registers/peripheral/exti.h"
+#include "registers/cortexm7/scb.h"
+#include "power/low_power.h"
+#include "clock/clock_ready.h"
+#include "clock/clock_gate.h"
+#include "boot/irq.h"
+#include "utility/cycle_counter.h"
+
+#define LOW_POWER_HZ_PER_MHZ 1000000UL
+#define LOW_POWER_NS_PER_US 1000UL
+#define LOW_POWER_MS_PER_S 1000UL
+#define LOW_POWER_NS_PER_TICK (1000000000UL / LOW_POWER_TICK_FREQ)
+
+// Asynchronous prescaler divides RTCCLK by 2 so that the sub second counter ticks as fast as the wakeup timer
+// Synchronous prescaler brings the calendar clock down to 1 Hz
+#define LOW_POWER_PREDIV_A 1UL
+#define LOW_POWER_PREDIV_S (LOW_POWER_TICK_FREQ - 1UL)
+
+IRQ_DECLARE(RTC_WKUP, IRQ_PRIORITY_LOWEST);
+
+/**
+ * @brief Clock turned off by the hardware when entering Stop mode
+ */
+typedef struct {
+	clock_ready_source source;   /*!< Clock source */
+	uint32_t on_mask;            /*!< Enable bit in the clock control register */
+} low_power_clock;
+
+// Oscillators are restarted before the PLLs as they may be their reference clock
+static const low_power_clock low_power_oscillators[] = {
+	{ .source = CLOCK_READY_HSE,   .on_mask = RCC_CR_HSEON_MASK   },
+	{ .source = CLOCK_READY_CSI,   .on_mask = RCC_CR_CSION_MASK   },
+	{ .source = CLOCK_READY_HSI48, .on_mask = RCC_CR_HSI48ON_MASK }
+};
+
+// PLL1 is restored together with the clock profile
+static const low_power_clock low_power_plls[] = {
+	{ .source = CLOCK_READY_PLL2, .on_mask = RCC_CR_PLL2ON_MASK },
+	{ .source = CLOCK_READY_PLL3, .on_mask = RCC_CR_PLL3ON_MASK }
+};
+
+static bool low_power_ready;
+static low_power_wakeup low_power_last;
+
+static void low_power_rtc_unlock(void) {
+	MODIFY_REG(RTC_COMMON->WPR, RTC_WPRKEY_UNLOCK1);
+	MODIFY_REG(RTC_COMMON->WPR, RTC_WPRKEY_UNLOCK2);
+}
+
+static void low_power_rtc_lock(void) {
+	MODIFY_REG(RTC_COMMON->WPR, RTC_WPRKEY_LOCK);
+}
+
+static uint32_t low_power_subsecond_get(void) {
+	// Shadow registers are bypassed hence the counter is read until two consecutive reads match
+	uint32_t subsecond = 0;
+	uint32_t previous = 0;
+	do {
+		previous = subsecond;
+		subsecond = GET_FIELD_VALUE(RTC_COMMON->SSR, RTC, SSR, SS);
+	} while (subsecond != previous);
+
+	return subsecond;
+}
+
+static void low_power_wakeup_timer_set(uint32_t ticks) {
+	low_power_rtc_unlock();
+
+	MODIFY_FIELD(RTC_COMMON->CR, RTC, CR, WUTE, RTC_WAKEUP_DISABLE);
+
+	if (ticks != 0) {
+		while (GET_FIELD_VALUE(RTC_COMMON->ISR, RTC, ISR, WUTWF) != RTC_WAKEUPWRITE_ALLOWED) {
+		}
+
+		MODIFY_REG(RTC_COMMON->WUTR, REGISTER_FIELD_SETTER(RTC, WUTR, WUT, (ticks - 1UL)));
+		CLEAR_BITS(RTC_COMMON->ISR, RTC_ISR_WUTF_MASK);
+		MODIFY_FIELD(RTC_COMMON->CR, RTC, CR, WUTE, RTC_WAKEUP_ENABLE);
+	}
+
+	low_power_rtc_lock();
+}
+
+static void low_power_restart(const low_power_clock * clocks, uint32_t number, uint32_t cr) {
+	for (uint32_t idx = 0; idx < number; idx++) {
+		if ((cr & clocks[idx].on_mask) != 0) {
+			(void)clock_ready_start(clocks[idx].source, NULL);
+		}
+	}
+
+	// Clocks lock in parallel
+	for (uint32_t idx = 0; idx < number; idx++) {
+		clock_ready_wait(clocks[idx].source);
+	}
+}
+
+static uint32_t low_power_cycles_to_ns(uint32_t cycles, uint32_t freq) {
+	// Split the conversion in order not to overflow 32 bits
+	const uint32_t mhz = freq / LOW_POWER_HZ_PER_MHZ;
+	return ((cycles / mhz) * LOW_POWER_NS_PER_US) + (((cycles % mhz) * LOW_POWER_NS_PER_US) / mhz);
+}
+
+bool low_power_init(void) {
+
+	(void)clock_ready_start(CLOCK_READY_LSI, NULL);
+	clock_ready_wait(CLOCK_READY_LSI);
+
+	// RTC clock source can only be changed by resetting the backup domain which would also lose the warm boot state
+	SET_BITS(PWR_COMMON->CR1, PWR_CR1_DBP_MASK);
+	const uint32_t rtc_source = GET_FIELD_VALUE(RCC_COMMON->BDCR, RCC, BDCR, RTCSEL);
+	if (rtc_source == RCC_RTCSRC_NOCLK) {
+		MODIFY_FIELD(RCC_COMMON->BDCR, RCC, BDCR, RTCSEL, RCC_RTCSRC_LSI);
+	} else if (rtc_source != RCC_RTCSRC_LSI) {
+		return false;
+	}
+	MODIFY_FIELD(RCC_COMMON->BDCR, RCC, BDCR, RTCEN, RCC_RTC_ENABLE);
+
+	// RTC registers are accessed while the core runs and the RTC keeps running in Stop mode on its own kernel clock
+	clock_gate_acquire(CLOCK_GATE(APB4, RTCAPB), false);
+
+	low_power_rtc_unlock();
+
+	MODIFY_FIELD(RTC_COMMON->ISR, RTC, ISR, INIT, RTC_INITMODE_INIT);
+	while (GET_FIELD_VALUE(RTC_COMMON->ISR, RTC, ISR, INITF) != RTC_INITFLAG_ALLOWED) {
+	}
+
+	// Prescalers must be written with two separate accesses
+	MODIFY_REG(RTC_COMMON->PRER, REGISTER_FIELD_SETTER(RTC, PRER, PREDIV_S, LOW_POWER_PREDIV_S));
+	MODIFY_REG(RTC_COMMON->PRER, (REGISTER_FIELD_SETTER(RTC, PRER, PREDIV_A, LOW_POWER_PREDIV_A) | REGISTER_FIELD_SETTER(RTC, PRER, PREDIV_S, LOW_POWER_PREDIV_S)));
+
+	MODIFY_FIELD(RTC_COMMON->ISR, RTC, ISR, INIT, RTC_INITMODE_FREERUN);
+
+	MODIFY_FIELD(RTC_COMMON->CR, RTC, CR, WUTE, RTC_WAKEUP_DISABLE);
+	MODIFY_FIELD(RTC_COMMON->CR, RTC, CR, BYPSHAD, RTC_SHADOWREG_BYPASS);
+	MODIFY_FIELD(RTC_COMMON->CR, RTC, CR, WUCKSEL, RTC_WAKEUPCLK_DIV2);
+	MODIFY_FIELD(RTC_COMMON->CR, RTC, CR, WUTIE, RTC_WAKEUPINT_ENABLE);
+
+	low_power_rtc_lock();
+
+	// Wakeup timer event is routed to CPU1 as a rising edge interrupt
+	SET_BITS(EXTI_COMMON->RTSR1, EXTI_LINE_MASK(EXTI_LINE_RTC_WAKEUP));
+	SET_BITS(EXTI_COMMON->C1IMR1, EXTI_LINE_MASK(EXTI_LINE_RTC_WAKEUP));
+	MODIFY_REG(EXTI_COMMON->C1PR1, EXTI_LINE_MASK(EXTI_LINE_RTC_WAKEUP));
+
+	// Domains retain their content in Stop mode and the regulator is scaled down to the lowest voltage
+	MODIFY_FIELD(PWR_COMMON->CPU1CR, PWR, CPU1CR, PDDS_D1, PWR_PWRDOWNDS_KEEPSTOPMODE);
+	MODIFY_FIELD(PWR_COMMON->CPU1CR, PWR, CPU1CR, PDDS_D2, PWR_PWRDOWNDS_KEEPSTOPMODE);
+	MODIFY_FIELD(PWR_COMMON->CPU1CR, PWR, CPU1CR, PDDS_D3, PWR_PWRDOWNDS_KEEPSTOPMODE);
+	MODIFY_FIELD(PWR_COMMON->CR1, PWR, CR1, SVOS, PWR_SYSSTOPVS_SCALE5);
+	MODIFY_FIELD(PWR_COMMON->CR1, PWR, CR1, LPDS, PWR_LPDSSVOS3_VRLPMODE);
+	MODIFY_FIELD(PWR_COMMON->CR1, PWR, CR1, FLPS, PWR_FLASHLPSTOP_LPMODE);
+
+	low_power_ready = true;
+
+	return true;
+}
+
+bool low_power_stop(uint32_t ms) {
+
+	if ((low_power_ready == false) || (ms == 0) || (ms > LOW_POWER_STOP_MAX_MS)) {
+		return false;
+	}
+
+	const uint32_t ticks = (ms * LOW_POWER_TICK_FREQ) / LOW_POWER_MS_PER_S;
+	const dvfs_profile profile = dvfs_get_profile();
+
+	// Stop mode is entered from the clock it wakes up with
+	(void)dvfs_set_profile(DVFS_PROFILE_IDLE);
+
+	const uint32_t cr = GET_REG(RCC_COMMON->CR);
+
+	MODIFY_FIELD(PWR_COMMON->CPU1CR, PWR, CPU1CR, CSSF, PWR_D1FLAGSCLR_CLRFLAGS);
+	MODIFY_FIELD(CORTEXM7SCB->SCR, SCB, SCR, SLEEPDEEP, SCB_SLEEPDEEP_DEEPSLEEP);
+
+	low_power_wakeup_timer_set(ticks);
+	const uint32_t armed = low_power_subsecond_get();
+
+	// Interrupts are masked so that the first instruction after WFI is timestamped before the wakeup interrupt is serviced
+	__asm__ volatile ("cpsid i" : : : "memory");
+	__asm__ volatile ("dsb" : : : "memory");
+	__asm__ volatile ("wfi");
+	const uint32_t wake = cycle_counter_get();
+	const uint32_t woken = low_power_subsecond_get();
+	const bool timer_expired = (GET_FIELD_VALUE(RTC_COMMON->ISR, RTC, ISR, WUTF) == RTC_WAKEUPFLAG_EXPIRED);
+	MODIFY_FIELD(CORTEXM7SCB->SCR, SCB, SCR, SLEEPDEEP, SCB_SLEEPDEEP_SLEEP);
+	__asm__ volatile ("cpsie i" : : : "memory");
+
+	low_power_wakeup_timer_set(0);
+
+	low_power_restart(low_power_oscillators, (sizeof(low_power_oscillators)/sizeof(low_power_clock)), cr);
+	low_power_restart(low_power_plls, (sizeof(low_power_plls)/sizeof(low_power_clock)), cr);
+
+	const uint32_t restarted = cycle_counter_elapsed(wake);
+
+	(void)dvfs_set_profile(profile);
+
+	// Sub second counter counts down and wraps around every second
+	const uint32_t elapsed = (armed + LOW_POWER_TICK_FREQ - woken) % LOW_POWER_TICK_FREQ;
+	const uint32_t latency = (elapsed + LOW_POWER_TICK_FREQ - (ticks % LOW_POWER_TICK_FREQ)) % LOW_POWER_TICK_FREQ;
+
+	low_power_last.stop_entered = (GET_FIELD_VALUE(PWR_COMMON->CPU1CR, PWR, CPU1CR, STOPF) == PWR_SYSSTOP_ENTERED);
+	low_power_last.timer_expired = timer_expired;
+	low_power_last.wake_to_instruction_ns = (timer_expired == true) ? (latency * LOW_POWER_NS_PER_TICK) : 0;
+	low_power_last.wake_to_full_speed_ns = low_power_cycles_to_ns(restarted, dvfs_get_profile_config(DVFS_PROFILE_IDLE)->core_freq);
+	if (profile != DVFS_PROFILE_IDLE) {
+		low_power_last.wake_to_full_speed_ns += dvfs_get_transition_ns(DVFS_PROFILE_IDLE, profile);
+	}
+	low_power_last.profile = profile;
+
+	return true;
+}
+
+const low_power_wakeup * low_power_get_wakeup(void) {
+	return &low_power_last;
+}
+
+void RTC_WKUP_irq_handler(void) {
+	CLEAR_BITS(RTC_COMMON->ISR, RTC_ISR_WUTF_MASK);
+	MODIFY_REG(EXTI_COMMON->C1PR1, EXTI_LINE_MASK(EXTI_LINE_RTC_WAKEUP));
+}
@@ -0,0 +1,57 @@
+/**
+ * @copyright
+ * @file low_power_benchmark.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Low power benchmark functions
+ */
+
+#ifdef BENCHMARK
+
+#include <stdbool.h>
+
+#include "benchmark/low_power_benchmark.h"
+#include "power/low_power.h"
+#include "clock/dvfs.h"
+
+low_power_benchmark_result low_power_benchmark;
+
+static void low_power_benchmark_record(low_power_benchmark_latency * latency, uint32_t * sum, uint32_t ns, bool first) {
+	if ((first == true) || (ns < latency->min_ns)) {
+		latency->min_ns = ns;
+	}
+	if ((first == true) || (ns > latency->max_ns)) {
+		latency->max_ns = ns;
+	}
+	*sum += ns;
+}
+
+void low_power_benchmark_run(void) {
+
+	uint32_t instruction_sum = 0;
+	uint32_t full_speed_sum = 0;
+	uint32_t iterations = 0;
+
+	(void)dvfs_set_profile(DVFS_PROFILE_BURST);
+
+	for (uint32_t idx = 0; idx < LOW_POWER_BENCHMARK_ITERATIONS; idx++) {
+		const bool stopped = low_power_stop(LOW_POWER_BENCHMARK_STOP_MS);
+		const low_power_wakeup * wakeup = low_power_get_wakeup();
+		if ((stopped == true) && (wakeup->timer_expired == true)) {
+			low_power_benchmark_record(&low_power_benchmark.wake_to_instruction, &instruction_sum, wakeup->wake_to_instruction_ns, (iterations == 0));
+			low_power_benchmark_record(&low_power_benchmark.wake_to_full_speed, &full_speed_sum, wakeup->wake_to_full_speed_ns, (iterations == 0));
+			if (wakeup->stop_entered == true) {
+				low_power_benchmark.stop_entered++;
+			}
+			iterations++;
+		}
+	}
+
+	if (iterations != 0) {
+		low_power_benchmark.wake_to_instruction.average_ns = instruction_sum / iterations;
+		low_power_benchmark.wake_to_full_speed.average_ns = full_speed_sum / iterations;
+	}
+
+}
+
+#endif // BENCHMARK
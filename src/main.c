@@ -7,10 +7,31 @@
  */
 
 #include "config/config.h"
+#include "boot/deferred_bss.h"
+#include "boot/boot_timeline.h"
+#include "boot/warm_boot.h"
+#include "boot/vector_table.h"
+#include "boot/irq.h"
+#include "boot/image_crc.h"
+#include "clock/dvfs.h"
+#include "clock/clock_tree.h"
+#include "clock/clock_gate.h"
+#include "power/low_power.h"
+#include "storage/flash_writer.h"
+
+#ifdef BENCHMARK
+#include "benchmark/itcm_benchmark.h"
+#include "benchmark/crc_benchmark.h"
+#include "benchmark/dvfs_benchmark.h"
+#include "benchmark/low_power_benchmark.h"
+#endif // BENCHMARK
 
 #include "registers/peripheral/gpio.h"
 #include "registers/peripheral/rcc.h"
 
+/*!< Time spent in Stop mode by each iteration of the main loop in milliseconds */
+#define MAIN_STOP_MS 1000U
+
 void gpio_blink() {
 
 	if (GET_FIELD_VALUE(GPIO_GPIOC->IDR, GPIO, IDR, IDR13) == GPIO_1) {
@@ -37,8 +58,10 @@ void gpio_blink() {
 
 void gpio_setup() {
 
-	MODIFY_FIELD(RCC_COMMON->AHB4ENR, RCC, AHB4ENR, GPIOBEN, RCC_PERIPHERALCLK_ENABLE);
-	MODIFY_FIELD(RCC_COMMON->AHB4ENR, RCC, AHB4ENR, GPIOEEN, RCC_PERIPHERALCLK_ENABLE);
+	// Outputs hold their level without a peripheral clock hence GPIO clocks are stopped while the core sleeps
+	clock_gate_acquire(CLOCK_GATE(AHB4, GPIOB), false);
+	clock_gate_acquire(CLOCK_GATE(AHB4, GPIOC), false);
+	clock_gate_acquire(CLOCK_GATE(AHB4, GPIOE), false);
 
 
 	// LED1 configuration is connected to PB0
@@ -69,12 +92,60 @@ void gpio_setup() {
 
 int main(int argc, char * argv[]) {
 
+	// Record the boot timeline first in order not to account for the time spent in main
+	boot_timeline_commit();
+
+	// Vector table has been copied to the DTCM by the startup code
+	vector_table_install();
+
+	// Priorities and enables of the interrupts declared by drivers
+	irq_config_apply();
+
+	// Big buffers are cleared in background while the system is being configured
+	deferred_bss_start();
+
 	clk_config();
 
+	// Collect the checksum of the image computed by the flash CRC unit since systemInit
+	const image_crc_status image_status = image_crc_check();
+
+	// Snapshot the clock tree so that a software or watchdog reset restores it without configuring it again
+	// A corrupted image is not trusted to restart through the warm boot path hence the next reset configures the clock tree from scratch. Delta patches are rejected too as they need a verified running image
+	if ((image_status == IMAGE_CRC_STATUS_MISMATCH) || (image_status == IMAGE_CRC_STATUS_READ_ERROR)) {
+		warm_boot_invalidate();
+	} else {
+		warm_boot_save();
+	}
+
+	// Clocks set up by the startup code are the burst profile
+	dvfs_init();
+
+	// Drivers query bus and kernel clock frequencies from the clock tree cache
+	clock_tree_init();
+
 	gpio_setup();
 
+	// Log resumes after the last flash word programmed in bank 2
+	flash_writer_init();
+
+	// RTC wakeup timer brings the core out of Stop mode
+	const bool stop_available = low_power_init();
+
+#ifdef BENCHMARK
+	itcm_benchmark_run();
+	crc_benchmark_run();
+	dvfs_benchmark_run();
+	if (stop_available == true) {
+		low_power_benchmark_run();
+	}
+#endif // BENCHMARK
+
 	while(1) {
 	//	gpio_blink();
+		// Flash operations must complete before domain D1 stops
+		if ((stop_available == true) && (flash_writer_is_busy() == false)) {
+			(void)low_power_stop(MAIN_STOP_MS);
+		}
 	}
 
 	return 0;
@@ -0,0 +1,168 @@
+/**
+ * @copyright
+ * @file pll_trim.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief PLL fractional trimming functions
+ */
+
+#include "registers/peripheral/rcc.h"
+#include "clock/pll_trim.h"
+
+// Number of bits of the fractional part of the multiplication factor
+#define PLL_TRIM_FRACN_BITS 13U
+
+// Number of outputs of each PLL
+#define PLL_TRIM_OUTPUTS 3U
+
+static volatile uint32_t * pll_trim_get_divr(uint32_t pll) {
+	switch (pll) {
+		case 1U:
+			return &RCC_COMMON->PLL1DIVR;
+		case 2U:
+			return &RCC_COMMON->PLL2DIVR;
+		default:
+			return &RCC_COMMON->PLL3DIVR;
+	}
+}
+
+static volatile uint32_t * pll_trim_get_fracr(uint32_t pll) {
+	switch (pll) {
+		case 1U:
+			return &RCC_COMMON->PLL1FRACR;
+		case 2U:
+			return &RCC_COMMON->PLL2FRACR;
+		default:
+			return &RCC_COMMON->PLL3FRACR;
+	}
+}
+
+static uint32_t pll_trim_get_fracen_mask(uint32_t pll) {
+	switch (pll) {
+		case 1U:
+			return REGISTER_FIELD_GLOBAL_MASK(RCC, PLLCFGR, PLL1FRACEN);
+		case 2U:
+			return REGISTER_FIELD_GLOBAL_MASK(RCC, PLLCFGR, PLL2FRACEN);
+		default:
+			return REGISTER_FIELD_GLOBAL_MASK(RCC, PLLCFGR, PLL3FRACEN);
+	}
+}
+
+static bool pll_trim_is_locked(uint32_t pll) {
+	switch (pll) {
+		case 1U:
+			return (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, PLL1RDY) == RCC_PLL_LOCKED);
+		case 2U:
+			return (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, PLL2RDY) == RCC_PLL_LOCKED);
+		default:
+			return (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, PLL3RDY) == RCC_PLL_LOCKED);
+	}
+}
+
+static uint32_t pll_trim_get_divm(uint32_t pll) {
+	switch (pll) {
+		case 1U:
+			return GET_FIELD_VALUE(RCC_COMMON->PLLCKSELR, RCC, PLLCKSELR, DIVM1);
+		case 2U:
+			return GET_FIELD_VALUE(RCC_COMMON->PLLCKSELR, RCC, PLLCKSELR, DIVM2);
+		default:
+			return GET_FIELD_VALUE(RCC_COMMON->PLLCKSELR, RCC, PLLCKSELR, DIVM3);
+	}
+}
+
+static uint32_t pll_trim_get_source_freq(void) {
+	switch (GET_FIELD_VALUE(RCC_COMMON->PLLCKSELR, RCC, PLLCKSELR, PLLSRC)) {
+		case RCC_PLLSRC_HSI:
+			return clock_tree_get_freq(CLOCK_TREE_HSI);
+		case RCC_PLLSRC_CSI:
+			return clock_tree_get_freq(CLOCK_TREE_CSI);
+		case RCC_PLLSRC_HSE:
+			return clock_tree_get_freq(CLOCK_TREE_HSE);
+		default:
+			return 0;
+	}
+}
+
+bool pll_trim_set_fracn(uint32_t pll, uint32_t fracn) {
+
+	if ((pll < PLL_TRIM_PLL_FIRST) || (pll > PLL_TRIM_PLL_NUMBER) || (fracn > PLL_TRIM_FRACN_MAX)) {
+		return false;
+	}
+
+	// Toggling the fractional mode of a PLL locked in integer mode would move its VCO
+	const uint32_t fracen_mask = pll_trim_get_fracen_mask(pll);
+	if ((pll_trim_is_locked(pll) == false) || ((GET_REG(RCC_COMMON->PLLCFGR) & fracen_mask) == 0)) {
+		return false;
+	}
+
+	// FRACN is latched on the rising edge of the fractional mode enable bit
+	CLEAR_BITS(RCC_COMMON->PLLCFGR, fracen_mask);
+	MODIFY_REG(*pll_trim_get_fracr(pll), REGISTER_FIELD_SETTER(RCC, PLLFRACR, FRACN, fracn));
+	SET_BITS(RCC_COMMON->PLLCFGR, fracen_mask);
+
+	clock_tree_invalidate();
+
+	return true;
+}
+
+uint32_t pll_trim_set_freq(clock_tree_clock output, uint32_t freq) {
+
+	if ((output < CLOCK_TREE_PLL1P) || (output > CLOCK_TREE_PLL3R) || (clock_tree_get_freq(output) == 0)) {
+		return 0;
+	}
+
+	const uint32_t pll = ((output - CLOCK_TREE_PLL1P) / PLL_TRIM_OUTPUTS) + 1U;
+	if (pll < PLL_TRIM_PLL_FIRST) {
+		return 0;
+	}
+	const uint32_t divr = GET_REG(*pll_trim_get_divr(pll));
+
+	uint32_t divider = 0;
+	switch ((output - CLOCK_TREE_PLL1P) % PLL_TRIM_OUTPUTS) {
+		case 0U:
+			divider = GET_FIELD_VALUE(divr, RCC, PLLDIVR, DIVP) + 1UL;
+			break;
+		case 1U:
+			divider = GET_FIELD_VALUE(divr, RCC, PLLDIVR, DIVQ) + 1UL;
+			break;
+		default:
+			divider = GET_FIELD_VALUE(divr, RCC, PLLDIVR, DIVR) + 1UL;
+			break;
+	}
+
+	// Target beyond any VCO frequency
+	if (freq > (UINT32_MAX / divider)) {
+		return 0;
+	}
+
+	const uint32_t ref = pll_trim_get_source_freq() / pll_trim_get_divm(pll);
+	const uint32_t vco_integer = ref * (GET_FIELD_VALUE(divr, RCC, PLLDIVR, DIVN) + 1UL);
+	const uint32_t vco_target = freq * divider;
+
+	if ((vco_target < vco_integer) || ((vco_target - vco_integer) >= ref)) {
+		return 0;
+	}
+
+	// Compute (remainder * 8192) / ref one bit at a time as the product overflows 32 bits
+	uint32_t remainder = vco_target - vco_integer;
+	uint32_t fracn = 0;
+	for (uint32_t bit = 0; bit < PLL_TRIM_FRACN_BITS; bit++) {
+		remainder <<= 1;
+		fracn <<= 1;
+		if (remainder >= ref) {
+			remainder -= ref;
+			fracn |= 1UL;
+		}
+	}
+
+	// Round to the closest step
+	if (((remainder << 1) >= ref) && (fracn < PLL_TRIM_FRACN_MAX)) {
+		fracn++;
+	}
+
+	if (pll_trim_set_fracn(pll, fracn) == false) {
+		return 0;
+	}
+
+	return clock_tree_get_freq(output);
+}
@@ -0,0 +1,80 @@
+/**
+ * @copyright
+ * @file spurious_irq.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Spurious interrupt accounting functions
+ */
+
+#include "registers/cortexm7/nvic.h"
+#include "boot/spurious_irq.h"
+#include "boot/sections.h"
+#include "utility/cycle_counter.h"
+
+// Statistics are indexed by exception number. They are placed in the DTCM as they are updated during interrupt storms
+static spurious_irq_stats spurious_irq_table[SPURIOUS_IRQ_VECTORS] DTCM_BSS;
+
+static uint32_t spurious_irq_ipsr(void) {
+	uint32_t ipsr = 0;
+	__asm__ volatile ("mrs %0, ipsr" : "=r" (ipsr));
+	return ipsr;
+}
+
+static void spurious_irq_disable(uint32_t irq) {
+	MODIFY_REG(CORTEXM7NVIC->ICER[irq / 32U], (0x1UL << (irq % 32U)));
+	MODIFY_REG(CORTEXM7NVIC->ICPR[irq / 32U], (0x1UL << (irq % 32U)));
+
+	// Make sure the interrupt is disabled before returning from the exception
+	__asm__ volatile ("dsb" : : : "memory");
+	__asm__ volatile ("isb" : : : "memory");
+}
+
+void spuriousInterruptHandler(void) {
+
+	// Exception number is in bits 8:0
+	const uint32_t exception = spurious_irq_ipsr() & 0x1FFUL;
+
+	// Exception numbers from 2 to 6 are the non maskable interrupt and faults: returning would execute the faulting instruction again
+	if ((exception >= (uint32_t)(IRQ_SYSTEM_EXCEPTIONS + IRQ_NMI)) && (exception <= (uint32_t)(IRQ_SYSTEM_EXCEPTIONS + IRQ_UsageFault))) {
+		while(1) {
+		}
+	}
+
+	if (exception >= SPURIOUS_IRQ_VECTORS) {
+		return;
+	}
+
+	spurious_irq_stats * stats = &spurious_irq_table[exception];
+	const uint32_t now = cycle_counter_get();
+
+	stats->count++;
+
+	if ((now - stats->window_start) > SPURIOUS_IRQ_WINDOW_CYCLES) {
+		stats->window_start = now;
+		stats->window_count = 0;
+	}
+	stats->window_count++;
+
+	// System exceptions cannot be disabled in the NVIC
+	if ((stats->window_count > SPURIOUS_IRQ_STORM_THRESHOLD) && (exception >= IRQ_SYSTEM_EXCEPTIONS)) {
+		spurious_irq_disable(exception - IRQ_SYSTEM_EXCEPTIONS);
+		stats->disabled = 1;
+	}
+
+}
+
+uint32_t spurious_irq_count(irq_number irq) {
+	return spurious_irq_table[IRQ_SYSTEM_EXCEPTIONS + irq].count;
+}
+
+bool spurious_irq_is_disabled(irq_number irq) {
+	return (spurious_irq_table[IRQ_SYSTEM_EXCEPTIONS + irq].disabled != 0);
+}
+
+uint32_t spurious_irq_total(void) {
+	uint32_t total = 0;
+	for (uint32_t exception = 0; exception < SPURIOUS_IRQ_VECTORS; exception++) {
+		total += spurious_irq_table[exception].count;
+	}
+	return total;
+}
@@ -0,0 +1,40 @@
+/**
+ * @copyright
+ * @file vector_table.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Vector table functions
+ */
+
+#include "registers/cortexm7/scb.h"
+#include "boot/vector_table.h"
+
+// Start address of the vector table in the DTCM from the linker script
+extern vector_handler _sramvector[];
+
+void vector_table_install(void) {
+
+	// Table offset bits 6:0 are reserved hence the whole address is written
+	MODIFY_REG(CORTEXM7SCB->VTOR, (uint32_t)_sramvector);
+
+	// Exceptions taken after this point must use the new table
+	__asm__ volatile ("dsb" : : : "memory");
+	__asm__ volatile ("isb" : : : "memory");
+}
+
+vector_handler vector_table_set_handler(irq_number irq, vector_handler handler) {
+
+	vector_handler * entry = &_sramvector[IRQ_SYSTEM_EXCEPTIONS + irq];
+	vector_handler previous = *entry;
+
+	*entry = handler;
+
+	// Complete the write before the interrupt can be taken again
+	__asm__ volatile ("dsb" : : : "memory");
+
+	return previous;
+}
+
+vector_handler vector_table_get_handler(irq_number irq) {
+	return _sramvector[IRQ_SYSTEM_EXCEPTIONS + irq];
+}
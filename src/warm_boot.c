@@ -0,0 +1,165 @@
+/**
+ * @copyright
+ * @file warm_boot.c
+ * @author Andrea Gianarda
+ * @date 17th of October 2026
+ * @brief Warm boot functions
+ */
+
+#include "registers/peripheral/rcc.h"
+#include "registers/peripheral/flash.h"
+#include "boot/warm_boot.h"
+#include "boot/sections.h"
+
+static warm_boot_state warm_boot BKPSRAM_NOINIT;
+
+// It is written by warmBootDetect before the uninitialized data sections are cleared
+static bool warm_boot_active NOINIT;
+
+static uint32_t warm_boot_checksum(void) {
+	const uint32_t * word = (const uint32_t *)&warm_boot;
+	// Checksum is the last word of the state hence it is not part of the computation
+	const uint32_t words = (sizeof(warm_boot) / sizeof(uint32_t)) - 1U;
+
+	// Rotate before XOR-ing so that swapped words are detected
+	uint32_t checksum = WARM_BOOT_MAGIC;
+	for (uint32_t idx = 0; idx < words; idx++) {
+		checksum = ((checksum << 1) | (checksum >> 31)) ^ word[idx];
+	}
+
+	return checksum;
+}
+
+bool warmBootDetect(void) {
+
+	const uint32_t rsr = GET_REG(RCC_COMMON->RSR);
+
+	// Power on and brown out resets reset the RCC and leave the content of the backup SRAM undefined unless VBAT is connected
+	const bool power_reset = (GET_FIELD(rsr, RCC, RSR, PORRSTF) != 0) || (GET_FIELD(rsr, RCC, RSR, BORRSTF) != 0);
+	const bool recovery_reset = (GET_FIELD(rsr, RCC, RSR, SFT1RSTF) != 0) || (GET_FIELD(rsr, RCC, RSR, IWDG1RSTF) != 0) || (GET_FIELD(rsr, RCC, RSR, WWDG1RSTF) != 0);
+
+	warm_boot_active = ((power_reset == false) && (recovery_reset == true) && (warm_boot.magic == WARM_BOOT_MAGIC) && (warm_boot.checksum == warm_boot_checksum()));
+
+	return warm_boot_active;
+}
+
+void warmBootRestoreClock(void) {
+
+	const warm_boot_clock_snapshot * clock = &warm_boot.clock;
+
+	// Register values were computed and validated by the boot that saved them, hence they are written as they are
+	MODIFY_REG(RCC_COMMON->PLLCKSELR, clock->pllckselr);
+	MODIFY_REG(RCC_COMMON->PLLCFGR, clock->pllcfgr);
+	MODIFY_REG(RCC_COMMON->PLL1DIVR, clock->pll1divr);
+	MODIFY_REG(RCC_COMMON->PLL1FRACR, clock->pll1fracr);
+	MODIFY_REG(RCC_COMMON->PLL2DIVR, clock->pll2divr);
+	MODIFY_REG(RCC_COMMON->PLL2FRACR, clock->pll2fracr);
+	MODIFY_REG(RCC_COMMON->PLL3DIVR, clock->pll3divr);
+	MODIFY_REG(RCC_COMMON->PLL3FRACR, clock->pll3fracr);
+
+	// Oscillators that may feed the PLLs must be ready before the PLLs are turned on
+	if (GET_FIELD_VALUE(clock->cr, RCC, CR, HSEON) == RCC_CLK_ENABLE) {
+		SET_BITS(RCC_COMMON->CR, (GET_FIELD(clock->cr, RCC, CR, HSEBYP) | GET_FIELD(clock->cr, RCC, CR, HSEON)));
+		while (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, HSERDY) != RCC_CLK_READY) {
+		}
+	}
+
+	if (GET_FIELD_VALUE(clock->cr, RCC, CR, CSION) == RCC_CLK_ENABLE) {
+		SET_BITS(RCC_COMMON->CR, GET_FIELD(clock->cr, RCC, CR, CSION));
+		while (GET_FIELD_VALUE(RCC_COMMON->CR, RCC, CR, CSIRDY) != RCC_CLK_READY) {
+		}
+	}
+
+	// PLLs lock while the startup code initializes memory
+	SET_BITS(RCC_COMMON->CR, (
+		GET_FIELD(clock->cr, RCC, CR, PLL3ON) |
+		GET_FIELD(clock->cr, RCC, CR, PLL2ON) |
+		GET_FIELD(clock->cr, RCC, CR, PLL1ON) )
+	);
+
+}
+
+void warmBootRestoreBus(void) {
+
+	const warm_boot_clock_snapshot * clock = &warm_boot.clock;
+
+	MODIFY_REG(RCC_COMMON->D1CFGR, clock->d1cfgr);
+	MODIFY_REG(RCC_COMMON->D2CFGR, clock->d2cfgr);
+	MODIFY_REG(RCC_COMMON->D3CFGR, clock->d3cfgr);
+
+	// Flash latency is still at its reset value (7 wait states) hence it is safe to increase the frequency first
+	MODIFY_REG(RCC_COMMON->CFGR, clock->cfgr);
+	while (GET_FIELD_VALUE(RCC_COMMON->CFGR, RCC, CFGR, SWS) != GET_FIELD_VALUE(clock->cfgr, RCC, CFGR, SW)) {
+	}
+
+	MODIFY_REG(FLASH_BANK1->ACR, clock->flash_acr);
+
+}
+
+bool warm_boot_is_active(void) {
+	return warm_boot_active;
+}
+
+void warm_boot_save(void) {
+
+	warm_boot_clock_snapshot * clock = &warm_boot.clock;
+
+	clock->cr = GET_REG(RCC_COMMON->CR);
+	clock->cfgr = GET_REG(RCC_COMMON->CFGR);
+	clock->d1cfgr = GET_REG(RCC_COMMON->D1CFGR);
+	clock->d2cfgr = GET_REG(RCC_COMMON->D2CFGR);
+	clock->d3cfgr = GET_REG(RCC_COMMON->D3CFGR);
+	clock->pllckselr = GET_REG(RCC_COMMON->PLLCKSELR);
+	clock->pllcfgr = GET_REG(RCC_COMMON->PLLCFGR);
+	clock->pll1divr = GET_REG(RCC_COMMON->PLL1DIVR);
+	clock->pll1fracr = GET_REG(RCC_COMMON->PLL1FRACR);
+	clock->pll2divr = GET_REG(RCC_COMMON->PLL2DIVR);
+	clock->pll2fracr = GET_REG(RCC_COMMON->PLL2FRACR);
+	clock->pll3divr = GET_REG(RCC_COMMON->PLL3DIVR);
+	clock->pll3fracr = GET_REG(RCC_COMMON->PLL3FRACR);
+	clock->flash_acr = GET_REG(FLASH_BANK1->ACR);
+
+	// Calibration cached before a cold boot is not trusted as sensors may have been replaced
+	if (warm_boot_active == false) {
+		warm_boot.calibration_words = 0;
+	}
+
+	warm_boot.magic = WARM_BOOT_MAGIC;
+	warm_boot.checksum = warm_boot_checksum();
+
+}
+
+void warm_boot_invalidate(void) {
+	warm_boot.magic = 0;
+}
+
+bool warm_boot_calibration_load(uint32_t * calibration, uint32_t words) {
+
+	if ((warm_boot_active == false) || (words > warm_boot.calibration_words)) {
+		return false;
+	}
+
+	for (uint32_t idx = 0; idx < words; idx++) {
+		calibration[idx] = warm_boot.calibration[idx];
+	}
+
+	return true;
+}
+
+void warm_boot_calibration_store(const uint32_t * calibration, uint32_t words) {
+
+	if (words > WARM_BOOT_CALIBRATION_WORDS) {
+		words = WARM_BOOT_CALIBRATION_WORDS;
+	}
+
+	for (uint32_t idx = 0; idx < words; idx++) {
+		warm_boot.calibration[idx] = calibration[idx];
+	}
+	warm_boot.calibration_words = words;
+
+	// Checksum is only valid once the clock tree snapshot has been saved
+	if (warm_boot.magic == WARM_BOOT_MAGIC) {
+		warm_boot.checksum = warm_boot_checksum();
+	}
+
+}